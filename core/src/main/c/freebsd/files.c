@@ -27,12 +27,16 @@
 #include <errno.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <dirent.h>
+#include <sys/stat.h>
 
 #if defined(__APPLE__)
 #include <copyfile.h>
 #include <unistd.h>
 #include <sys/fcntl.h>
 #include <sys/mount.h>
+#include <sys/param.h>
 #else
 #include <unistd.h>
 #include <sys/fcntl.h>
@@ -94,6 +98,24 @@ JNIEXPORT jint JNICALL Java_io_questdb_std_Files_copy
     return result;
 }
 
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_openDirect0
+        (JNIEnv *e, jclass cl, jlong fd) {
+    char path[MAXPATHLEN];
+    if (fcntl((int) fd, F_GETPATH, path) == -1) {
+        return -1;
+    }
+    const int directFd = open(path, O_WRONLY | O_CLOEXEC);
+    if (directFd == -1) {
+        return -1;
+    }
+    // there is no O_DIRECT on OSX, F_NOCACHE is the equivalent
+    if (fcntl(directFd, F_NOCACHE, 1) == -1) {
+        close(directFd);
+        return -1;
+    }
+    return directFd;
+}
+
 JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_getFileSystemStatus
         (JNIEnv *e, jclass cl, jlong lpszName) {
     struct statfs sb;
@@ -113,6 +135,13 @@ JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_getFileSystemStatus
 
 #else
 
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_openDirect0
+        (JNIEnv *e, jclass cl, jlong fd) {
+    // file path cannot be recovered from descriptor, direct I/O is not supported
+    errno = ENOTSUP;
+    return -1;
+}
+
 JNIEXPORT jint JNICALL Java_io_questdb_std_Files_copy
         (JNIEnv *e, jclass cls, jlong lpszFrom, jlong lpszTo) {
     const char* from = (const char *) lpszFrom;
@@ -167,4 +196,86 @@ JNIEXPORT jint JNICALL Java_io_questdb_std_Files_copy
 }
 #endif
 
+typedef struct {
+    DIR *dir;
+    // entry that did not fit into previous batch
+    struct dirent *pending;
+} SCAN_DIR;
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_scanDirOpen0
+        (JNIEnv *e, jclass cl, jlong lpszName) {
+    DIR *dir = opendir((const char *) lpszName);
+    if (dir == NULL) {
+        return errno == ENOENT ? 0 : -1;
+    }
+    SCAN_DIR *scan = malloc(sizeof(SCAN_DIR));
+    if (scan == NULL) {
+        closedir(dir);
+        errno = ENOMEM;
+        return -1;
+    }
+    scan->dir = dir;
+    scan->pending = NULL;
+    return (jlong) scan;
+}
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_scanDirNext
+        (JNIEnv *e, jclass cl, jlong scanPtr, jlong address, jlong len, jint flags) {
+    SCAN_DIR *scan = (SCAN_DIR *) scanPtr;
+    char *out = (char *) address;
+    jlong written = 0;
+
+    while (1) {
+        struct dirent *d = scan->pending;
+        if (d == NULL) {
+            errno = 0;
+            d = readdir(scan->dir);
+            if (d == NULL) {
+                return errno == 0 || written > 0 ? written : -1;
+            }
+        }
+
+        const size_t nameLen = strlen(d->d_name);
+        const jlong recordLen = (jlong) ((com_questdb_std_Files_SCAN_DIR_NAME_OFFSET + nameLen + 1 + 7) & ~7);
+        if (written + recordLen > len) {
+            scan->pending = d;
+            if (written == 0) {
+                errno = EINVAL;
+                return -1;
+            }
+            return written;
+        }
+        scan->pending = NULL;
+
+        jint type = (jint) d->d_type;
+        jlong size = -1;
+        if ((flags & com_questdb_std_Files_SCAN_DIR_STAT) != 0) {
+            struct stat st;
+            if (fstatat(dirfd(scan->dir), d->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0) {
+                size = (jlong) st.st_size;
+                if (type == com_questdb_std_Files_DT_UNKNOWN) {
+                    type = (jint) IFTODT(st.st_mode);
+                }
+            } else if (errno != ENOENT) {
+                scan->pending = d;
+                return written > 0 ? written : -1;
+            }
+        }
+
+        char *rec = out + written;
+        *(jint *) rec = (jint) recordLen;
+        *(jint *) (rec + com_questdb_std_Files_SCAN_DIR_TYPE_OFFSET) = type;
+        *(jlong *) (rec + com_questdb_std_Files_SCAN_DIR_SIZE_OFFSET) = size;
+        memcpy(rec + com_questdb_std_Files_SCAN_DIR_NAME_OFFSET, d->d_name, nameLen + 1);
+        written += recordLen;
+    }
+}
+
+JNIEXPORT void JNICALL Java_io_questdb_std_Files_scanDirClose
+        (JNIEnv *e, jclass cl, jlong scanPtr) {
+    SCAN_DIR *scan = (SCAN_DIR *) scanPtr;
+    closedir(scan->dir);
+    free(scan);
+}
+
 
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <jni.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include "../share/net.h"
+
+JNIEXPORT jlong JNICALL Java_io_questdb_network_Net_sendFile
+        (JNIEnv *e, jclass cl, jlong fd, jlong sockFd, jlong offset, jlong len) {
+#ifdef __APPLE__
+    off_t sent = (off_t) len;
+    const int rc = sendfile((int) fd, (int) sockFd, (off_t) offset, &sent, NULL, 0);
+#else
+    off_t sent = 0;
+    const int rc = sendfile((int) fd, (int) sockFd, (off_t) offset, (size_t) len, NULL, &sent, 0);
+#endif
+    // non-blocking socket can take part of the data before reporting EAGAIN
+    if (sent > 0) {
+        return sent;
+    }
+
+    if (rc == 0) {
+        // nothing was sent without an error, file ends at offset
+        return len > 0 ? com_questdb_network_Net_EEOF : 0;
+    }
+
+    if (errno == EAGAIN) {
+        return com_questdb_network_Net_ERETRY;
+    }
+
+    return com_questdb_network_Net_EOTHERDISCONNECT;
+}
@@ -29,11 +29,20 @@
 #include <errno.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <dirent.h>
 #include <sys/sendfile.h>
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/fcntl.h>
 #include <sys/vfs.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
 
 static inline jlong _io_questdb_std_Files_mremap0
         (jlong fd, jlong address, jlong previousLen, jlong newLen, jlong offset, jint flags) {
@@ -55,31 +64,215 @@ JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_mremap0
     return _io_questdb_std_Files_mremap0(fd, address, previousLen, newLen, offset, flags);
 }
 
-JNIEXPORT jint JNICALL Java_io_questdb_std_Files_copy
-        (JNIEnv *e, jclass cls, jlong lpszFrom, jlong lpszTo) {
-    const char *from = (const char *) lpszFrom;
-    const char *to = (const char *) lpszTo;
-    const int input = open(from, O_RDONLY);
-    if (-1 == (input)) {
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_openDirect0
+        (JNIEnv *e, jclass cl, jlong fd) {
+    // reopen file via procfs to get a separate descriptor, toggling O_DIRECT
+    // on the original would affect every thread sharing it
+    char path[32];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", (int) fd);
+    return open(path, O_WRONLY | O_DIRECT | O_CLOEXEC);
+}
+
+#ifndef __NR_copy_file_range
+#if defined(__x86_64__)
+#define __NR_copy_file_range 326
+#elif defined(__aarch64__)
+#define __NR_copy_file_range 285
+#endif
+#endif
+
+static inline ssize_t sys_copy_file_range(int fd_in, loff_t *off_in, int fd_out, loff_t *off_out, size_t len) {
+#ifdef __NR_copy_file_range
+    // called via syscall() because glibc wrapper is only available since 2.27
+    return syscall(__NR_copy_file_range, fd_in, off_in, fd_out, off_out, len, 0);
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+// copy_file_range() and sendfile() transfer at most 0x7ffff000 bytes per call
+#define COPY_CHUNK_SIZE 0x40000000L
+
+// values of Files.COPY_METHOD_*
+#define COPY_METHOD_CLONE 0
+#define COPY_METHOD_RANGE 1
+#define COPY_METHOD_SENDFILE 2
+
+static jlong copy_data(int input, int output, jlong srcOffset, jlong dstOffset, jlong length, int method) {
+    jlong total = 0;
+    while (total < length) {
+        const size_t len = (size_t) (length - total < COPY_CHUNK_SIZE ? length - total : COPY_CHUNK_SIZE);
+        ssize_t n;
+        if (method == COPY_METHOD_RANGE) {
+            // copy_file_range() shares extents on btrfs and XFS and never moves data via user space
+            loff_t inOff = srcOffset + total;
+            loff_t outOff = dstOffset + total;
+            n = sys_copy_file_range(input, &inOff, output, &outOff, len);
+        } else {
+            // sendfile() writes at the current position of output
+            off_t inOff = srcOffset + total;
+            if (lseek(output, dstOffset + total, SEEK_SET) < 0) {
+                return -1;
+            }
+            n = sendfile(output, input, &inOff, len);
+        }
+
+        if (n > 0) {
+            total += n;
+        } else if (n == 0) {
+            // end of input file
+            break;
+        } else if (errno != EINTR) {
+            return -1;
+        }
+    }
+    return total;
+}
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_copyData
+        (JNIEnv *e, jclass cls, jlong srcFd, jlong dstFd, jlong srcOffset, jlong dstOffset, jlong length, jint method) {
+    switch (method) {
+        case COPY_METHOD_CLONE:
+            // reflink shares whole file, it is instant on copy-on-write file systems
+            // and fails fast with EOPNOTSUPP, EXDEV or EINVAL on others
+            if (srcOffset != 0 || dstOffset != 0) {
+                errno = EINVAL;
+                return -1;
+            }
+            return ioctl((int) dstFd, FICLONE, (int) srcFd) == -1 ? -1 : length;
+        case COPY_METHOD_RANGE:
+        case COPY_METHOD_SENDFILE:
+            return copy_data((int) srcFd, (int) dstFd, srcOffset, dstOffset, length, method);
+        default:
+            errno = EINVAL;
+            return -1;
+    }
+}
+
+// Directory scan reads entries with getdents64() in large batches and, when requested,
+// stats them relative to the open directory descriptor. Entries are packed into caller's
+// buffer, so that a directory of thousands of entries takes a handful of JNI calls.
+
+#ifndef SYS_getdents64
+#define SYS_getdents64 __NR_getdents64
+#endif
+
+#define SCAN_DIR_BUF_SIZE (64 * 1024)
+
+struct linux_dirent64 {
+    ino64_t d_ino;
+    off64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+typedef struct {
+    int fd;
+    int pos;
+    int len;
+    char buf[SCAN_DIR_BUF_SIZE] __attribute__((aligned(8)));
+} SCAN_DIR;
+
+static int stat_entry(int dirfd, const char *name, jint *type, jlong *size) {
+#ifdef STATX_SIZE
+    struct statx stx;
+    if (statx(dirfd, name, AT_SYMLINK_NOFOLLOW | AT_STATX_DONT_SYNC, STATX_TYPE | STATX_SIZE, &stx) == 0) {
+        *size = (jlong) stx.stx_size;
+        if (*type == com_questdb_std_Files_DT_UNKNOWN) {
+            *type = (jint) IFTODT(stx.stx_mode);
+        }
+        return 0;
+    }
+    if (errno != ENOSYS) {
         return -1;
     }
+#endif
+    struct stat st;
+    if (fstatat(dirfd, name, &st, AT_SYMLINK_NOFOLLOW) == 0) {
+        *size = (jlong) st.st_size;
+        if (*type == com_questdb_std_Files_DT_UNKNOWN) {
+            *type = (jint) IFTODT(st.st_mode);
+        }
+        return 0;
+    }
+    return -1;
+}
 
-    const int output = creat(to, 0644);
-    if (-1 == (output)) {
-        close(input);
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_scanDirOpen0
+        (JNIEnv *e, jclass cl, jlong lpszName) {
+    const int fd = open((const char *) lpszName, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd == -1) {
+        return errno == ENOENT ? 0 : -1;
+    }
+    SCAN_DIR *scan = malloc(sizeof(SCAN_DIR));
+    if (scan == NULL) {
+        close(fd);
+        errno = ENOMEM;
         return -1;
     }
+    scan->fd = fd;
+    scan->pos = 0;
+    scan->len = 0;
+    return (jlong) scan;
+}
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_scanDirNext
+        (JNIEnv *e, jclass cl, jlong scanPtr, jlong address, jlong len, jint flags) {
+    SCAN_DIR *scan = (SCAN_DIR *) scanPtr;
+    char *out = (char *) address;
+    jlong written = 0;
+
+    while (1) {
+        if (scan->pos == scan->len) {
+            const long n = syscall(SYS_getdents64, scan->fd, scan->buf, SCAN_DIR_BUF_SIZE);
+            if (n < 0) {
+                return written > 0 ? written : -1;
+            }
+            if (n == 0) {
+                return written;
+            }
+            scan->pos = 0;
+            scan->len = (int) n;
+        }
 
-    // On linux sendfile can accept file as well as sockets
-    off_t offset = 0;
-    struct stat fileStat = {0};
-    fstat(input, &fileStat);
-    int result = sendfile(output, input, &offset, fileStat.st_size);
+        while (scan->pos < scan->len) {
+            struct linux_dirent64 *d = (struct linux_dirent64 *) (scan->buf + scan->pos);
+            const size_t nameLen = strlen(d->d_name);
+            const jlong recordLen = (jlong) ((com_questdb_std_Files_SCAN_DIR_NAME_OFFSET + nameLen + 1 + 7) & ~7);
+            if (written + recordLen > len) {
+                if (written == 0) {
+                    // buffer cannot take even a single entry
+                    errno = EINVAL;
+                    return -1;
+                }
+                return written;
+            }
 
-    close(input);
-    close(output);
+            jint type = (jint) d->d_type;
+            jlong size = -1;
+            if ((flags & com_questdb_std_Files_SCAN_DIR_STAT) != 0 && stat_entry(scan->fd, d->d_name, &type, &size) != 0
+                && errno != ENOENT) {
+                return written > 0 ? written : -1;
+            }
+
+            char *rec = out + written;
+            *(jint *) rec = (jint) recordLen;
+            *(jint *) (rec + com_questdb_std_Files_SCAN_DIR_TYPE_OFFSET) = type;
+            *(jlong *) (rec + com_questdb_std_Files_SCAN_DIR_SIZE_OFFSET) = size;
+            memcpy(rec + com_questdb_std_Files_SCAN_DIR_NAME_OFFSET, d->d_name, nameLen + 1);
+            written += recordLen;
+            scan->pos += d->d_reclen;
+        }
+    }
+}
 
-    return result;
+JNIEXPORT void JNICALL Java_io_questdb_std_Files_scanDirClose
+        (JNIEnv *e, jclass cl, jlong scanPtr) {
+    SCAN_DIR *scan = (SCAN_DIR *) scanPtr;
+    close(scan->fd);
+    free(scan);
 }
 
 JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_getFileSystemStatus
@@ -0,0 +1,312 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <jni.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include "io_uring.h"
+
+// io_uring is driven via raw system calls, so that we do not depend on liburing
+// being present on the build machine. The ring is single producer, single consumer:
+// the Java side owns a ring per thread.
+
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+
+#ifndef IORING_SQ_CQ_OVERFLOW
+#define IORING_SQ_CQ_OVERFLOW (1U << 1)
+#endif
+
+static inline int sys_io_uring_setup(unsigned entries, struct io_uring_params *p) {
+    return (int) syscall(__NR_io_uring_setup, entries, p);
+}
+
+static inline int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return (int) syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+qdb_uring *qdb_uring_create(unsigned entries) {
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+
+    const int fd = sys_io_uring_setup(entries, &p);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    qdb_uring *ring = calloc(1, sizeof(qdb_uring));
+    if (ring == NULL) {
+        close(fd);
+        errno = ENOMEM;
+        return NULL;
+    }
+    ring->fd = fd;
+
+    ring->sq_sz = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ring->cq_sz = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    const int single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        if (ring->cq_sz > ring->sq_sz) {
+            ring->sq_sz = ring->cq_sz;
+        }
+        ring->cq_sz = ring->sq_sz;
+    }
+
+    ring->sq_ptr = mmap(NULL, ring->sq_sz, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ptr == MAP_FAILED) {
+        goto fail;
+    }
+
+    if (single_mmap) {
+        ring->cq_ptr = ring->sq_ptr;
+    } else {
+        ring->cq_ptr = mmap(NULL, ring->cq_sz, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ptr == MAP_FAILED) {
+            ring->cq_ptr = NULL;
+            goto fail;
+        }
+    }
+
+    ring->sqes_sz = p.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_sz, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        goto fail;
+    }
+
+    char *sq = (char *) ring->sq_ptr;
+    ring->sq_head = (unsigned *) (sq + p.sq_off.head);
+    ring->sq_tail = (unsigned *) (sq + p.sq_off.tail);
+    ring->sq_mask = *(unsigned *) (sq + p.sq_off.ring_mask);
+    ring->sq_entries = *(unsigned *) (sq + p.sq_off.ring_entries);
+    ring->sq_array = (unsigned *) (sq + p.sq_off.array);
+    ring->sq_flags = (unsigned *) (sq + p.sq_off.flags);
+
+    char *cq = (char *) ring->cq_ptr;
+    ring->cq_head = (unsigned *) (cq + p.cq_off.head);
+    ring->cq_tail = (unsigned *) (cq + p.cq_off.tail);
+    ring->cq_mask = *(unsigned *) (cq + p.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *) (cq + p.cq_off.cqes);
+    return ring;
+
+    fail:
+    {
+        const int err = errno;
+        qdb_uring_close(ring);
+        errno = err;
+        return NULL;
+    }
+}
+
+void qdb_uring_close(qdb_uring *ring) {
+    if (ring->sqes != NULL) {
+        munmap(ring->sqes, ring->sqes_sz);
+    }
+    if (ring->cq_ptr != NULL && ring->cq_ptr != ring->sq_ptr) {
+        munmap(ring->cq_ptr, ring->cq_sz);
+    }
+    if (ring->sq_ptr != NULL && ring->sq_ptr != MAP_FAILED) {
+        munmap(ring->sq_ptr, ring->sq_sz);
+    }
+    close(ring->fd);
+    free(ring);
+}
+
+struct io_uring_sqe *qdb_uring_next_sqe(qdb_uring *ring) {
+    const unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    const unsigned tail = *ring->sq_tail + ring->pending_unpublished;
+    if (tail - head >= ring->sq_entries) {
+        return NULL;
+    }
+    const unsigned index = tail & ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    ring->sq_array[index] = index;
+    ring->pending_unpublished++;
+    return sqe;
+}
+
+static inline void qdb_uring_publish(qdb_uring *ring) {
+    if (ring->pending_unpublished > 0) {
+        __atomic_store_n(ring->sq_tail, *ring->sq_tail + ring->pending_unpublished, __ATOMIC_RELEASE);
+        ring->pending += ring->pending_unpublished;
+        ring->pending_unpublished = 0;
+    }
+}
+
+int qdb_uring_submit(qdb_uring *ring, unsigned wait_nr) {
+    qdb_uring_publish(ring);
+    // completions that did not fit into the completion queue are held by the kernel and
+    // are only moved back into the queue when the ring is entered with GETEVENTS
+    const int overflow = (__atomic_load_n(ring->sq_flags, __ATOMIC_ACQUIRE) & IORING_SQ_CQ_OVERFLOW) != 0;
+    if (ring->pending == 0 && wait_nr == 0 && !overflow) {
+        return 0;
+    }
+    const unsigned flags = wait_nr > 0 || overflow ? IORING_ENTER_GETEVENTS : 0;
+    int rc;
+    do {
+        rc = sys_io_uring_enter(ring->fd, ring->pending, wait_nr, flags);
+    } while (rc < 0 && errno == EINTR);
+    if (rc > 0) {
+        ring->pending -= (unsigned) rc;
+    }
+    return rc;
+}
+
+int qdb_uring_prep(
+        qdb_uring *ring,
+        int op,
+        int fd,
+        jlong offset,
+        jlong address,
+        jlong len,
+        jlong user_data,
+        int flags
+) {
+    struct io_uring_sqe *sqe = qdb_uring_next_sqe(ring);
+    if (sqe == NULL) {
+        return 0;
+    }
+    sqe->fd = fd;
+    sqe->user_data = (__u64) user_data;
+    if (flags & com_questdb_std_IOURing_FLAG_LINK) {
+        sqe->flags |= IOSQE_IO_LINK;
+    }
+    switch (op) {
+        case com_questdb_std_IOURing_OP_READ:
+            sqe->opcode = IORING_OP_READ;
+            sqe->off = (__u64) offset;
+            sqe->addr = (__u64) address;
+            sqe->len = (__u32) len;
+            break;
+        case com_questdb_std_IOURing_OP_WRITE:
+            sqe->opcode = IORING_OP_WRITE;
+            sqe->off = (__u64) offset;
+            sqe->addr = (__u64) address;
+            sqe->len = (__u32) len;
+            break;
+        case com_questdb_std_IOURing_OP_FSYNC:
+            sqe->opcode = IORING_OP_FSYNC;
+            break;
+        case com_questdb_std_IOURing_OP_FDATASYNC:
+            sqe->opcode = IORING_OP_FSYNC;
+            sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+            break;
+        case com_questdb_std_IOURing_OP_FALLOCATE:
+            // fallocate has unusual layout: length goes into addr and mode into len
+            sqe->opcode = IORING_OP_FALLOCATE;
+            sqe->off = (__u64) offset;
+            sqe->addr = (__u64) len;
+            sqe->len = 0;
+            break;
+        case com_questdb_std_IOURing_OP_SYNC_FILE_RANGE:
+            sqe->opcode = IORING_OP_SYNC_FILE_RANGE;
+            sqe->off = (__u64) offset;
+            sqe->len = (__u32) len;
+            sqe->sync_range_flags = SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER;
+            break;
+        case com_questdb_std_IOURing_OP_POLL_ADD:
+            // one-shot poll, events mask is passed as length
+            sqe->opcode = IORING_OP_POLL_ADD;
+            sqe->poll32_events = (__u32) len;
+            break;
+        case com_questdb_std_IOURing_OP_POLL_REMOVE:
+            // poll to be removed is identified by its user data
+            sqe->opcode = IORING_OP_POLL_REMOVE;
+            sqe->addr = (__u64) address;
+            break;
+        default:
+            sqe->opcode = IORING_OP_NOP;
+            break;
+    }
+    return 1;
+}
+
+int qdb_uring_reap(qdb_uring *ring, jlong *out, int max) {
+    unsigned head = *ring->cq_head;
+    const unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    int n = 0;
+    while (head != tail && n < max) {
+        const struct io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+        out[2 * n] = (jlong) cqe->user_data;
+        out[2 * n + 1] = (jlong) cqe->res;
+        head++;
+        n++;
+    }
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    return n;
+}
+
+JNIEXPORT jboolean JNICALL Java_io_questdb_std_IOURing_isAvailable0
+        (JNIEnv *e, jclass cl) {
+    qdb_uring *ring = qdb_uring_create(2);
+    if (ring == NULL) {
+        return JNI_FALSE;
+    }
+    qdb_uring_close(ring);
+    return JNI_TRUE;
+}
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_IOURing_create
+        (JNIEnv *e, jclass cl, jint capacity) {
+    qdb_uring *ring = qdb_uring_create((unsigned) capacity);
+    if (ring == NULL) {
+        return -1;
+    }
+    return (jlong) ring;
+}
+
+JNIEXPORT void JNICALL Java_io_questdb_std_IOURing_close0
+        (JNIEnv *e, jclass cl, jlong ring) {
+    qdb_uring_close((qdb_uring *) ring);
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_std_IOURing_prep
+        (JNIEnv *e, jclass cl, jlong ring, jint op, jlong fd, jlong offset, jlong address, jlong len, jlong userData,
+         jint flags) {
+    return qdb_uring_prep((qdb_uring *) ring, op, (int) fd, offset, address, len, userData, flags);
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_std_IOURing_submit
+        (JNIEnv *e, jclass cl, jlong ring, jint waitNr) {
+    const int rc = qdb_uring_submit((qdb_uring *) ring, (unsigned) waitNr);
+    return rc < 0 ? -errno : rc;
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_std_IOURing_reap
+        (JNIEnv *e, jclass cl, jlong ring, jlong address, jint max) {
+    return qdb_uring_reap((qdb_uring *) ring, (jlong *) address, max);
+}
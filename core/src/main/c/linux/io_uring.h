@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+#ifndef QUESTDB_IO_URING_H
+#define QUESTDB_IO_URING_H
+
+#include <jni.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+
+#define com_questdb_std_IOURing_OP_NOP 0L
+#define com_questdb_std_IOURing_OP_READ 1L
+#define com_questdb_std_IOURing_OP_WRITE 2L
+#define com_questdb_std_IOURing_OP_FSYNC 3L
+#define com_questdb_std_IOURing_OP_FDATASYNC 4L
+#define com_questdb_std_IOURing_OP_FALLOCATE 5L
+#define com_questdb_std_IOURing_OP_SYNC_FILE_RANGE 6L
+#define com_questdb_std_IOURing_OP_POLL_ADD 7L
+#define com_questdb_std_IOURing_OP_POLL_REMOVE 8L
+
+#define com_questdb_std_IOURing_FLAG_LINK 1L
+
+typedef struct {
+    int fd;
+    // submission queue
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_array;
+    unsigned *sq_flags;
+    unsigned sq_mask;
+    unsigned sq_entries;
+    struct io_uring_sqe *sqes;
+    // entries prepared, but not yet visible to the kernel
+    unsigned pending_unpublished;
+    // entries visible to the kernel, but not yet submitted
+    unsigned pending;
+    // completion queue
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe *cqes;
+    // mapped regions
+    void *sq_ptr;
+    size_t sq_sz;
+    void *cq_ptr;
+    size_t cq_sz;
+    size_t sqes_sz;
+} qdb_uring;
+
+qdb_uring *qdb_uring_create(unsigned entries);
+
+void qdb_uring_close(qdb_uring *ring);
+
+struct io_uring_sqe *qdb_uring_next_sqe(qdb_uring *ring);
+
+// publishes prepared entries and submits them, optionally waiting for wait_nr completions
+int qdb_uring_submit(qdb_uring *ring, unsigned wait_nr);
+
+// returns 1 when operation has been queued and 0 when submission queue is full
+int qdb_uring_prep(
+        qdb_uring *ring,
+        int op,
+        int fd,
+        jlong offset,
+        jlong address,
+        jlong len,
+        jlong user_data,
+        int flags
+);
+
+// copies up to max (user_data, res) pairs of completed operations to out
+int qdb_uring_reap(qdb_uring *ring, jlong *out, int max);
+
+#endif //QUESTDB_IO_URING_H
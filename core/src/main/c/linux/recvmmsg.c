@@ -26,24 +26,96 @@
 #define _GNU_SOURCE
 #include "jni.h"
 #include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stddef.h>
 #include <string.h>
 
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+#ifndef SO_RXQ_OVFL
+#define SO_RXQ_OVFL 40
+#endif
+
+// each message has room for UDP_GRO segment size and SO_RXQ_OVFL drop counter
+#define MSG_CONTROL_SIZE (CMSG_SPACE(sizeof(int)) + CMSG_SPACE(sizeof(uint32_t)))
+
+// message vector is followed by the last seen value of socket drop counter
+static inline jlong *drop_count_ptr(struct mmsghdr *msgs, unsigned int vlen) {
+    return (jlong *) (msgs + vlen);
+}
+
+// reads control messages of received message and makes it ready for the next receive
+static inline int process_control(struct mmsghdr *msg, jlong *drops) {
+    int segment_size = 0;
+    struct msghdr *hdr = &msg->msg_hdr;
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(hdr, cmsg)) {
+        if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO) {
+            memcpy(&segment_size, CMSG_DATA(cmsg), sizeof(int));
+        } else if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL) {
+            uint32_t count;
+            memcpy(&count, CMSG_DATA(cmsg), sizeof(uint32_t));
+            if ((jlong) count > *drops) {
+                *drops = (jlong) count;
+            }
+        }
+    }
+    hdr->msg_controllen = MSG_CONTROL_SIZE;
+    return segment_size;
+}
 
 JNIEXPORT jint JNICALL Java_io_questdb_network_Net_recvmmsg
         (JNIEnv *e, jclass cl, jlong fd, jlong msgvec, jint vlen) {
-    struct timespec timeout;
-    timeout.tv_sec = 1;
-    timeout.tv_nsec = 0;
-    return recvmmsg((int) fd, (struct mmsghdr *) msgvec, (unsigned int) vlen, MSG_DONTWAIT, &timeout);
+    struct mmsghdr *msgs = (struct mmsghdr *) msgvec;
+    const int n = recvmmsg((int) fd, msgs, (unsigned int) vlen, MSG_DONTWAIT, NULL);
+    jlong *drops = drop_count_ptr(msgs, (unsigned int) vlen);
+    for (int i = 0; i < n; i++) {
+        process_control(&msgs[i], drops);
+    }
+    return n;
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_recvmmsgSegments
+        (JNIEnv *e, jclass cl, jlong fd, jlong msgvec, jint vlen, jlong segvec, jint segCapacity) {
+    struct mmsghdr *msgs = (struct mmsghdr *) msgvec;
+    const int n = recvmmsg((int) fd, msgs, (unsigned int) vlen, MSG_DONTWAIT, NULL);
+    if (n < 0) {
+        return n;
+    }
+
+    jlong *drops = drop_count_ptr(msgs, (unsigned int) vlen);
+    jlong *seg = (jlong *) segvec;
+    int segCount = 0;
+    for (int i = 0; i < n; i++) {
+        const int segment_size = process_control(&msgs[i], drops);
+        char *p = (char *) msgs[i].msg_hdr.msg_iov->iov_base;
+        char *hi = p + msgs[i].msg_len;
+        // message coalesced by GRO consists of equally sized datagrams, except the last one, which can be shorter
+        const size_t step = segment_size > 0 ? (size_t) segment_size : msgs[i].msg_len;
+        do {
+            if (segCount == segCapacity) {
+                return segCount;
+            }
+            const size_t len = (size_t) (hi - p) < step ? (size_t) (hi - p) : step;
+            seg[2 * segCount] = (jlong) p;
+            seg[2 * segCount + 1] = (jlong) len;
+            segCount++;
+            p += len;
+        } while (p < hi);
+    }
+    return segCount;
 }
 
 JNIEXPORT jlong JNICALL Java_io_questdb_network_Net_msgHeaders
         (JNIEnv *e, jclass cl, jint blockSize, jint blockCount) {
-    struct mmsghdr *msgs = malloc(sizeof(struct mmsghdr) * blockCount);
+    struct mmsghdr *msgs = malloc(sizeof(struct mmsghdr) * blockCount + sizeof(jlong));
     struct iovec *iovecs = malloc(sizeof(struct iovec) * blockCount);
     void *buf = malloc(((size_t) blockSize * (size_t) blockCount));
+    char *control = calloc((size_t) blockCount, MSG_CONTROL_SIZE);
 
     memset(msgs, 0, sizeof(struct mmsghdr) * blockCount);
     for (int i = 0; i < blockCount; i++) {
@@ -51,8 +123,12 @@ JNIEXPORT jlong JNICALL Java_io_questdb_network_Net_msgHeaders
         iovecs[i].iov_len = (size_t) blockSize;
         msgs[i].msg_hdr.msg_iov = &iovecs[i];
         msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_control = control;
+        msgs[i].msg_hdr.msg_controllen = MSG_CONTROL_SIZE;
         buf += blockSize;
+        control += MSG_CONTROL_SIZE;
     }
+    *drop_count_ptr(msgs, (unsigned int) blockCount) = 0;
 
     return (jlong) msgs;
 }
@@ -77,5 +153,18 @@ JNIEXPORT void JNICALL Java_io_questdb_network_Net_freeMsgHeaders
     struct mmsghdr *msgs = (struct mmsghdr *) address;
     free(msgs[0].msg_hdr.msg_iov->iov_base);
     free(msgs[0].msg_hdr.msg_iov);
+    free(msgs[0].msg_hdr.msg_control);
     free(msgs);
 }
+
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setUdpGro
+        (JNIEnv *e, jclass cl, jlong fd, jboolean enabled) {
+    int value = enabled ? 1 : 0;
+    return setsockopt((int) fd, SOL_UDP, UDP_GRO, &value, sizeof(value));
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setRxqOverflow
+        (JNIEnv *e, jclass cl, jlong fd, jboolean enabled) {
+    int value = enabled ? 1 : 0;
+    return setsockopt((int) fd, SOL_SOCKET, SO_RXQ_OVFL, &value, sizeof(value));
+}
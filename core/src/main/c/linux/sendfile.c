@@ -0,0 +1,49 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <jni.h>
+#include <errno.h>
+#include <sys/sendfile.h>
+#include "../share/net.h"
+
+JNIEXPORT jlong JNICALL Java_io_questdb_network_Net_sendFile
+        (JNIEnv *e, jclass cl, jlong fd, jlong sockFd, jlong offset, jlong len) {
+    off_t off = (off_t) offset;
+    const ssize_t n = sendfile((int) sockFd, (int) fd, &off, (size_t) len);
+    if (n > 0) {
+        return n;
+    }
+
+    if (n == 0) {
+        return len > 0 ? com_questdb_network_Net_EEOF : 0;
+    }
+
+    if (errno == EWOULDBLOCK) {
+        return com_questdb_network_Net_ERETRY;
+    }
+
+    return com_questdb_network_Net_EOTHERDISCONNECT;
+}
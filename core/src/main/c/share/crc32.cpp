@@ -0,0 +1,41 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <jni.h>
+#include "crc32_dispatch.h"
+
+extern "C" {
+
+DECLARE_DISPATCHER(crc32_update);
+
+JNIEXPORT jint JNICALL
+Java_io_questdb_std_Zip_crc32(JNIEnv */*env*/, jclass /*cl*/, jint crc, jlong address, jint available) {
+    return static_cast<jint>(crc32_update(
+            static_cast<uint32_t>(crc),
+            reinterpret_cast<const uint8_t *>(address),
+            available
+    ));
+}
+
+} // extern "C"
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "crc32_dispatch.h"
+
+#if INSTRSET >= 8
+
+// Every CPU with AVX2 also has carry-less multiplication, so the folding kernel is only
+// built for AVX2 and AVX512 dispatch targets.
+// Folding constants are the bit-reflected x^(n) mod P(x) values for the gzip polynomial,
+// see "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction", Intel, 2009.
+
+// Folds len bytes, len has to be a multiple of 16 and no less than 64.
+// crc is the raw (not inverted) register value.
+__attribute__((target("pclmul")))
+static uint32_t crc32_fold_pclmul(uint32_t crc, const uint8_t *buf, int64_t len) {
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5 = _mm_set_epi64x(0, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 16));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 32));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 48));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    buf += 64;
+    len -= 64;
+
+    // four independent 128-bit lanes, 64 bytes per iteration
+    for (; len >= 64; buf += 64, len -= 64) {
+        const __m128i t1 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        const __m128i t2 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        const __m128i t3 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        const __m128i t4 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, t1), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, t2), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 16)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, t3), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 32)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, t4), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 48)));
+    }
+
+    // fold lanes into one
+    __m128i t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x2), t);
+    t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x3), t);
+    t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x4), t);
+
+    for (; len >= 16; buf += 16, len -= 16) {
+        t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf))),
+                t
+        );
+    }
+
+    // 128 to 64 bits
+    t = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), t);
+    t = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00), t);
+
+    // Barrett reduction to 32 bits
+    t = _mm_and_si128(x1, mask32);
+    t = _mm_clmulepi64_si128(t, poly, 0x10);
+    t = _mm_and_si128(t, mask32);
+    t = _mm_clmulepi64_si128(t, poly, 0x00);
+    x1 = _mm_xor_si128(x1, t);
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+uint32_t MULTI_VERSION_NAME (crc32_update)(uint32_t crc, const uint8_t *buf, int64_t len) {
+    if (len >= 64) {
+        const int64_t n = len & ~static_cast<int64_t>(15);
+        crc = ~crc32_fold_pclmul(~crc, buf, n);
+        buf += n;
+        len -= n;
+    }
+    return crc32_vanilla(crc, buf, len);
+}
+
+#else
+
+uint32_t MULTI_VERSION_NAME (crc32_update)(uint32_t crc, const uint8_t *buf, int64_t len) {
+    return crc32_vanilla(crc, buf, len);
+}
+
+#endif
@@ -0,0 +1,46 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#ifndef QUESTDB_CRC32_DISPATCH_H
+#define QUESTDB_CRC32_DISPATCH_H
+
+#include <cstdint>
+#include <src/main/c/share/zlib-1.2.8/zlib.h>
+#include "dispatcher.h"
+
+inline uint32_t crc32_vanilla(uint32_t crc, const uint8_t *buf, int64_t len) {
+    // zlib takes 32-bit lengths
+    while (len > 0) {
+        const uInt n = len > INT32_MAX ? INT32_MAX : static_cast<uInt>(len);
+        crc = static_cast<uint32_t>(crc32(crc, buf, n));
+        buf += n;
+        len -= n;
+    }
+    return crc;
+}
+
+// Updates running gzip (ISO-HDLC) CRC32 with len bytes at buf, same as zlib's crc32().
+DECLARE_DISPATCHER_RET_TYPE(uint32_t, crc32_update, uint32_t crc, const uint8_t *buf, int64_t len);
+
+#endif //QUESTDB_CRC32_DISPATCH_H
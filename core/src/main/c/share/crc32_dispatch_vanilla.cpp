@@ -0,0 +1,5 @@
+#include "crc32_dispatch.h"
+
+uint32_t crc32_update(uint32_t crc, const uint8_t *buf, int64_t len) {
+    return crc32_vanilla(crc, buf, len);
+}
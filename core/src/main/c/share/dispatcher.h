@@ -31,6 +31,7 @@
 
 #define DECLARE_DISPATCHER(FUNCNAME)
 #define  DECLARE_DISPATCHER_TYPE(FUNCNAME, ...)  void FUNCNAME(__VA_ARGS__);
+#define  DECLARE_DISPATCHER_RET_TYPE(RET, FUNCNAME, ...)  RET FUNCNAME(__VA_ARGS__);
 
 #else // __aarch64__
 
@@ -42,6 +43,10 @@
 typedef void TF_ ## FUNCNAME(__VA_ARGS__);\
 TF_ ## FUNCNAME F_AVX512(FUNCNAME), F_AVX2(FUNCNAME), F_SSE41(FUNCNAME), F_VANILLA(FUNCNAME)
 
+#define DECLARE_DISPATCHER_RET_TYPE(RET, FUNCNAME, ...) \
+typedef RET TF_ ## FUNCNAME(__VA_ARGS__);\
+TF_ ## FUNCNAME F_AVX512(FUNCNAME), F_AVX2(FUNCNAME), F_SSE41(FUNCNAME), F_VANILLA(FUNCNAME)
+
 template<typename T>
 T *dispatch_to_ptr(T *avx512, T *avx2, T *sse4, T *vanilla) {
     const int iset = instrset_detect();
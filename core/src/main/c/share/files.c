@@ -56,13 +56,65 @@ JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_write
 JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_mmap0
         (JNIEnv *e, jclass cl, jlong fd, jlong len, jlong offset, jint flags, jlong baseAddress) {
     int prot = 0;
+    int mode = flags & (com_questdb_std_Files_MAP_RO | com_questdb_std_Files_MAP_RW);
 
-    if (flags == com_questdb_std_Files_MAP_RO) {
+    if (mode == com_questdb_std_Files_MAP_RO) {
         prot = PROT_READ;
-    } else if (flags == com_questdb_std_Files_MAP_RW) {
+    } else if (mode == com_questdb_std_Files_MAP_RW) {
         prot = PROT_READ | PROT_WRITE;
     }
-    return (jlong) mmap((void *) baseAddress, (size_t) len, prot, MAP_SHARED, (int) fd, offset);
+
+    int mapFlags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if (flags & com_questdb_std_Files_MAP_POPULATE) {
+        // pre-fault the whole range to avoid taking a page fault every page on the first scan
+        mapFlags |= MAP_POPULATE;
+    }
+#endif
+    if (flags & com_questdb_std_Files_MAP_FIXED) {
+        mapFlags |= MAP_FIXED;
+    }
+    return (jlong) mmap((void *) baseAddress, (size_t) len, prot, mapFlags, (int) fd, offset);
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_std_Files_madvise0
+        (JNIEnv *e, jclass cl, jlong address, jlong len, jint advice) {
+    int osAdvice;
+    switch (advice) {
+        case com_questdb_std_Files_POSIX_MADV_NORMAL:
+            osAdvice = POSIX_MADV_NORMAL;
+            break;
+        case com_questdb_std_Files_POSIX_MADV_RANDOM:
+            osAdvice = POSIX_MADV_RANDOM;
+            break;
+        case com_questdb_std_Files_POSIX_MADV_SEQUENTIAL:
+            osAdvice = POSIX_MADV_SEQUENTIAL;
+            break;
+        case com_questdb_std_Files_POSIX_MADV_WILLNEED:
+            osAdvice = POSIX_MADV_WILLNEED;
+            break;
+        case com_questdb_std_Files_POSIX_MADV_DONTNEED:
+            osAdvice = POSIX_MADV_DONTNEED;
+            break;
+#ifdef MADV_HUGEPAGE
+        case com_questdb_std_Files_MADV_HUGEPAGE:
+            return madvise((void *) address, (size_t) len, MADV_HUGEPAGE);
+#endif
+#ifdef MADV_COLD
+        case com_questdb_std_Files_MADV_COLD:
+            return madvise((void *) address, (size_t) len, MADV_COLD);
+#endif
+        default:
+            // advice is a hint, the ones OS does not know about are ignored
+            return 0;
+    }
+    // posix_madvise returns error code instead of setting errno
+    int rc = posix_madvise((void *) address, (size_t) len, osAdvice);
+    if (rc != 0) {
+        errno = rc;
+        return -1;
+    }
+    return 0;
 }
 
 JNIEXPORT jint JNICALL Java_io_questdb_std_Files_munmap0
@@ -70,6 +122,19 @@ JNIEXPORT jint JNICALL Java_io_questdb_std_Files_munmap0
     return munmap((void *) address, (size_t) len);
 }
 
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_mmapReserve0
+        (JNIEnv *e, jclass cl, jlong len, jlong baseAddress) {
+    // inaccessible address range, files are mapped over it with MAP_FIXED as they grow
+    int flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    if (baseAddress != 0) {
+        flags |= MAP_FIXED;
+    }
+    return (jlong) mmap((void *) baseAddress, (size_t) len, PROT_NONE, flags, -1, 0);
+}
+
 JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_append
         (JNIEnv *e, jclass cl,
          jlong fd,
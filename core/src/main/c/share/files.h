@@ -29,6 +29,32 @@ extern "C" {
 #define com_questdb_std_Files_MAP_RO 1L
 #undef com_questdb_std_Files_MAP_RW
 #define com_questdb_std_Files_MAP_RW 2L
+#undef com_questdb_std_Files_MAP_POPULATE
+#define com_questdb_std_Files_MAP_POPULATE 16L
+#undef com_questdb_std_Files_MAP_FIXED
+#define com_questdb_std_Files_MAP_FIXED 32L
+#undef com_questdb_std_Files_POSIX_MADV_NORMAL
+#define com_questdb_std_Files_POSIX_MADV_NORMAL 0L
+#undef com_questdb_std_Files_POSIX_MADV_RANDOM
+#define com_questdb_std_Files_POSIX_MADV_RANDOM 1L
+#undef com_questdb_std_Files_POSIX_MADV_SEQUENTIAL
+#define com_questdb_std_Files_POSIX_MADV_SEQUENTIAL 2L
+#undef com_questdb_std_Files_POSIX_MADV_WILLNEED
+#define com_questdb_std_Files_POSIX_MADV_WILLNEED 3L
+#undef com_questdb_std_Files_POSIX_MADV_DONTNEED
+#define com_questdb_std_Files_POSIX_MADV_DONTNEED 4L
+#undef com_questdb_std_Files_MADV_HUGEPAGE
+#define com_questdb_std_Files_MADV_HUGEPAGE 14L
+#undef com_questdb_std_Files_MADV_COLD
+#define com_questdb_std_Files_MADV_COLD 20L
+#undef com_questdb_std_Files_SCAN_DIR_STAT
+#define com_questdb_std_Files_SCAN_DIR_STAT 1L
+#undef com_questdb_std_Files_SCAN_DIR_TYPE_OFFSET
+#define com_questdb_std_Files_SCAN_DIR_TYPE_OFFSET 4L
+#undef com_questdb_std_Files_SCAN_DIR_SIZE_OFFSET
+#define com_questdb_std_Files_SCAN_DIR_SIZE_OFFSET 8L
+#undef com_questdb_std_Files_SCAN_DIR_NAME_OFFSET
+#define com_questdb_std_Files_SCAN_DIR_NAME_OFFSET 16L
 /*
  * Class:     com_questdb_std_Files
  * Method:    append
@@ -165,6 +191,30 @@ JNIEXPORT jint JNICALL Java_io_questdb_std_Files_close0
 JNIEXPORT jint JNICALL Java_io_questdb_std_Files_close
         (JNIEnv *, jclass, jlong, jlong);
 
+/*
+ * Class:     com_questdb_std_Files
+ * Method:    scanDirOpen0
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_scanDirOpen0
+        (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_questdb_std_Files
+ * Method:    scanDirNext
+ * Signature: (JJJI)J
+ */
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_scanDirNext
+        (JNIEnv *, jclass, jlong, jlong, jlong, jint);
+
+/*
+ * Class:     com_questdb_std_Files
+ * Method:    scanDirClose
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_io_questdb_std_Files_scanDirClose
+        (JNIEnv *, jclass, jlong);
+
 /*
  * Class:     com_questdb_std_Files
  * Method:    munmap0
@@ -173,6 +223,14 @@ JNIEXPORT jint JNICALL Java_io_questdb_std_Files_close
 JNIEXPORT jint JNICALL Java_io_questdb_std_Files_munmap0
         (JNIEnv *, jclass, jlong, jlong);
 
+/*
+ * Class:     com_questdb_std_Files
+ * Method:    mmapReserve0
+ * Signature: (JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_mmapReserve0
+        (JNIEnv *, jclass, jlong, jlong);
+
 /*
  * Class:     com_questdb_std_Files
  * Method:    mmap0
@@ -181,6 +239,22 @@ JNIEXPORT jint JNICALL Java_io_questdb_std_Files_munmap0
 JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_mmap0
         (JNIEnv *, jclass, jlong, jlong, jlong, jint, jlong);
 
+/*
+ * Class:     com_questdb_std_Files
+ * Method:    madvise0
+ * Signature: (JJI)I
+ */
+JNIEXPORT jint JNICALL Java_io_questdb_std_Files_madvise0
+        (JNIEnv *, jclass, jlong, jlong, jint);
+
+/*
+ * Class:     com_questdb_std_Files
+ * Method:    openDirect0
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_openDirect0
+        (JNIEnv *, jclass, jlong);
+
 /*
  * Class:     com_questdb_std_Files
  * Method:    mremap0
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <jni.h>
+#include "hash_dispatch.h"
+
+namespace {
+
+// reflected Castagnoli polynomial
+constexpr uint32_t CRC32C_POLY = 0x82f63b78;
+
+struct crc32c_table {
+    uint32_t t[8][256];
+
+    constexpr crc32c_table() : t() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c >> 1) ^ (CRC32C_POLY & (0 - (c & 1)));
+            }
+            t[0][i] = c;
+        }
+        for (uint32_t i = 0; i < 256; i++) {
+            for (int k = 1; k < 8; k++) {
+                t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xff];
+            }
+        }
+    }
+};
+
+// computed at compile time, there is no static initialisation
+constexpr crc32c_table CRC32C_TABLE;
+
+}
+
+uint32_t crc32c_sw(uint32_t crc, const uint8_t *buf, int64_t len) {
+    const auto &t = CRC32C_TABLE.t;
+    uint32_t c = ~crc;
+    for (; len >= 8; buf += 8, len -= 8) {
+        // little endian
+        const uint64_t w = hash_read64(buf) ^ c;
+        c = t[7][w & 0xff] ^ t[6][(w >> 8) & 0xff] ^ t[5][(w >> 16) & 0xff] ^ t[4][(w >> 24) & 0xff]
+            ^ t[3][(w >> 32) & 0xff] ^ t[2][(w >> 40) & 0xff] ^ t[1][(w >> 48) & 0xff] ^ t[0][w >> 56];
+    }
+    for (; len > 0; buf++, len--) {
+        c = (c >> 8) ^ t[0][(c ^ *buf) & 0xff];
+    }
+    return ~c;
+}
+
+extern "C" {
+
+DECLARE_DISPATCHER(crc32c_update);
+DECLARE_DISPATCHER(hash_long_column);
+
+JNIEXPORT jint JNICALL
+Java_io_questdb_std_HashNative_crc32c(
+        JNIEnv */*env*/,
+        jclass /*cl*/,
+        jint crc,
+        jlong address,
+        jlong len
+) {
+    return static_cast<jint>(crc32c_update(static_cast<uint32_t>(crc), reinterpret_cast<const uint8_t *>(address), len));
+}
+
+JNIEXPORT jlong JNICALL
+Java_io_questdb_std_HashNative_hashMem64(
+        JNIEnv */*env*/,
+        jclass /*cl*/,
+        jlong address,
+        jlong len
+) {
+    return static_cast<jlong>(hash_mem64(reinterpret_cast<const uint8_t *>(address), len));
+}
+
+JNIEXPORT void JNICALL
+Java_io_questdb_std_HashNative_hashLongColumn(
+        JNIEnv */*env*/,
+        jclass /*cl*/,
+        jlong address,
+        jlong count,
+        jlong hashesAddress
+) {
+    hash_long_column(
+            reinterpret_cast<const int64_t *>(address),
+            count,
+            reinterpret_cast<uint64_t *>(hashesAddress)
+    );
+}
+
+// Hashes UTF-16 bytes of rows [lo, hi) of a string column, null hashes the same as empty string.
+JNIEXPORT void JNICALL
+Java_io_questdb_std_HashNative_hashStrColumn(
+        JNIEnv */*env*/,
+        jclass /*cl*/,
+        jlong dataAddress,
+        jlong indexAddress,
+        jlong lo,
+        jlong hi,
+        jlong hashesAddress
+) {
+    const auto data = reinterpret_cast<const uint8_t *>(dataAddress);
+    const auto index = reinterpret_cast<const int64_t *>(indexAddress);
+    auto hashes = reinterpret_cast<uint64_t *>(hashesAddress);
+    for (int64_t i = lo; i < hi; i++) {
+        const uint8_t *p = data + index[i];
+        int32_t len;
+        memcpy(&len, p, 4);
+        hashes[i - lo] = len > 0 ? hash_mem64(p + 4, 2 * static_cast<int64_t>(len)) : 0;
+    }
+}
+
+}
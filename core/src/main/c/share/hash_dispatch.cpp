@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "hash_dispatch.h"
+
+#if INSTRSET >= 8
+
+// every CPU with AVX2 also supports SSE4.2 CRC32 instruction
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_hw(uint32_t crc, const uint8_t *buf, int64_t len) {
+    uint64_t c = ~crc;
+    for (; len >= 8; buf += 8, len -= 8) {
+        c = _mm_crc32_u64(c, hash_read64(buf));
+    }
+    auto c32 = static_cast<uint32_t>(c);
+    for (; len > 0; buf++, len--) {
+        c32 = _mm_crc32_u8(c32, *buf);
+    }
+    return ~c32;
+}
+
+#endif
+
+uint32_t MULTI_VERSION_NAME (crc32c_update)(uint32_t crc, const uint8_t *buf, int64_t len) {
+#if INSTRSET >= 8
+    return crc32c_hw(crc, buf, len);
+#else
+    return crc32c_sw(crc, buf, len);
+#endif
+}
+
+void MULTI_VERSION_NAME (hash_long_column)(const int64_t *src, int64_t count, uint64_t *dst) {
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        Vec8uq k;
+        k.load(src + i);
+        k ^= k >> 33;
+        k *= Vec8uq(0xff51afd7ed558ccdull);
+        k ^= k >> 33;
+        k *= Vec8uq(0xc4ceb9fe1a85ec53ull);
+        k ^= k >> 33;
+        k.store(dst + i);
+    }
+    hash_long_column_vanilla(src + i, count - i, dst + i);
+}
@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#ifndef QUESTDB_HASH_DISPATCH_H
+#define QUESTDB_HASH_DISPATCH_H
+
+#include <cstdint>
+#include <cstring>
+#include "dispatcher.h"
+
+constexpr uint64_t HASH_P1 = 0x9e3779b185ebca87ull;
+constexpr uint64_t HASH_P2 = 0xc2b2ae3d27d4eb4full;
+constexpr uint64_t HASH_P3 = 0x165667b19e3779f9ull;
+constexpr uint64_t HASH_P4 = 0x85ebca77c2b2ae63ull;
+constexpr uint64_t HASH_P5 = 0x27d4eb2f165667c5ull;
+
+inline uint64_t hash_read64(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+inline uint64_t hash_read32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+// folded 64x64 -> 128 bit multiplication
+inline uint64_t hash_mix128(uint64_t a, uint64_t b) {
+    const __uint128_t r = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+}
+
+inline uint64_t hash_avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= 0x165667919e3779f9ull;
+    return h ^ (h >> 32);
+}
+
+// 64-bit hash of memory in the manner of XXH3: short inputs are read as at most two
+// overlapping words, longer ones are consumed 32 bytes at a time by two independent
+// multiply lanes. Not a cryptographic hash, it is meant for hash tables and dedup.
+inline uint64_t hash_mem64(const uint8_t *p, int64_t len) {
+    const uint64_t seed = static_cast<uint64_t>(len) * HASH_P1;
+    if (len <= 16) {
+        if (len >= 8) {
+            return hash_avalanche(seed ^ hash_mix128(hash_read64(p) ^ HASH_P2, hash_read64(p + len - 8) ^ HASH_P3));
+        }
+        if (len >= 4) {
+            const uint64_t v = (hash_read32(p) << 32) | hash_read32(p + len - 4);
+            return hash_avalanche(seed ^ hash_mix128(v ^ HASH_P2, HASH_P4));
+        }
+        if (len > 0) {
+            const uint64_t v = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+            return hash_avalanche(seed ^ hash_mix128(v ^ HASH_P2, HASH_P5));
+        }
+        return 0;
+    }
+    uint64_t s0 = seed;
+    uint64_t s1 = seed ^ HASH_P2;
+    int64_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        s0 = hash_mix128(hash_read64(p + i) ^ HASH_P3, hash_read64(p + i + 8) ^ s0);
+        s1 = hash_mix128(hash_read64(p + i + 16) ^ HASH_P4, hash_read64(p + i + 24) ^ s1);
+    }
+    s0 ^= s1;
+    if (i + 16 <= len) {
+        s0 = hash_mix128(hash_read64(p + i) ^ HASH_P3, hash_read64(p + i + 8) ^ s0);
+    }
+    // last 16 bytes, they may overlap bytes that are already consumed
+    s0 = hash_mix128(hash_read64(p + len - 16) ^ HASH_P5, hash_read64(p + len - 8) ^ s0);
+    return hash_avalanche(s0);
+}
+
+// hash of 8 byte value, the finalizer of MurmurHash3
+inline uint64_t hash_long64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdull;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ull;
+    return k ^ (k >> 33);
+}
+
+// table driven CRC32C, slicing by 8 bytes
+uint32_t crc32c_sw(uint32_t crc, const uint8_t *buf, int64_t len);
+
+inline void hash_long_column_vanilla(const int64_t *src, int64_t count, uint64_t *dst) {
+    for (int64_t i = 0; i < count; i++) {
+        dst[i] = hash_long64(static_cast<uint64_t>(src[i]));
+    }
+}
+
+// Updates CRC32C (Castagnoli) of len bytes at buf, crc is the value returned by
+// the previous call or 0 to start. Uses SSE4.2 or ARMv8 CRC instructions when available.
+DECLARE_DISPATCHER_RET_TYPE(uint32_t, crc32c_update, uint32_t crc, const uint8_t *buf, int64_t len);
+
+// Writes hash_long64() of count values at src to dst.
+DECLARE_DISPATCHER_TYPE(hash_long_column, const int64_t *src, int64_t count, uint64_t *dst);
+
+#endif //QUESTDB_HASH_DISPATCH_H
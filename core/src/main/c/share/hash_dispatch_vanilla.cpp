@@ -0,0 +1,24 @@
+#include "hash_dispatch.h"
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+uint32_t crc32c_update(uint32_t crc, const uint8_t *buf, int64_t len) {
+#if defined(__ARM_FEATURE_CRC32)
+    uint32_t c = ~crc;
+    for (; len >= 8; buf += 8, len -= 8) {
+        c = __crc32cd(c, hash_read64(buf));
+    }
+    for (; len > 0; buf++, len--) {
+        c = __crc32cb(c, *buf);
+    }
+    return ~c;
+#else
+    return crc32c_sw(crc, buf, len);
+#endif
+}
+
+void hash_long_column(const int64_t *src, int64_t count, uint64_t *dst) {
+    hash_long_column_vanilla(src, count, dst);
+}
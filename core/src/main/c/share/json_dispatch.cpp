@@ -0,0 +1,40 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "json_dispatch.h"
+
+int64_t MULTI_VERSION_NAME (json_copy_plain_utf16)(const uint16_t *src, int64_t len, uint8_t *dst) {
+    int64_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        Vec32us v;
+        v.load(src + i);
+        const Vec32sb plain = (v >= 0x20) & (v < 0x7f) & (v != '"') & (v != '\\') & (v != '/');
+        // narrowing is exact for plain chars, the rest of the block is overwritten by the caller
+        compress(v).store(dst + i);
+        if (!horizontal_and(plain)) {
+            return i + horizontal_find_first(~plain);
+        }
+    }
+    return i + json_copy_plain_utf16_vanilla(src + i, len - i, dst + i);
+}
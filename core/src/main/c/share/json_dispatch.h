@@ -0,0 +1,50 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#ifndef QUESTDB_JSON_DISPATCH_H
+#define QUESTDB_JSON_DISPATCH_H
+
+#include <cstdint>
+#include "dispatcher.h"
+
+// UTF-16 chars that are written to JSON string as a single byte, without escaping:
+// printable ASCII except quote, backslash and forward slash.
+inline bool is_json_plain(uint16_t c) {
+    return c >= 0x20 && c < 0x7f && c != '"' && c != '\\' && c != '/';
+}
+
+inline int64_t json_copy_plain_utf16_vanilla(const uint16_t *src, int64_t len, uint8_t *dst) {
+    int64_t i = 0;
+    for (; i < len && is_json_plain(src[i]); i++) {
+        dst[i] = static_cast<uint8_t>(src[i]);
+    }
+    return i;
+}
+
+// Narrows leading run of plain chars of UTF-16 string to single bytes at dst.
+// Returns number of chars copied, the char at that index, if any, has to be either
+// escaped or UTF-8 encoded by the caller. Up to len bytes of dst may be written.
+DECLARE_DISPATCHER_RET_TYPE(int64_t, json_copy_plain_utf16, const uint16_t *src, int64_t len, uint8_t *dst);
+
+#endif //QUESTDB_JSON_DISPATCH_H
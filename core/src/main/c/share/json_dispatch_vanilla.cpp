@@ -0,0 +1,5 @@
+#include "json_dispatch.h"
+
+int64_t json_copy_plain_utf16(const uint16_t *src, int64_t len, uint8_t *dst) {
+    return json_copy_plain_utf16_vanilla(src, len, dst);
+}
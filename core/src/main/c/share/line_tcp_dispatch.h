@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#ifndef QUESTDB_LINE_TCP_DISPATCH_H
+#define QUESTDB_LINE_TCP_DISPATCH_H
+
+#include <cstdint>
+#include "dispatcher.h"
+
+// Bytes the line protocol parser has to look at one by one. Everything else is
+// copied verbatim into names and values. Bytes with the high bit set are included,
+// so that non-ASCII detection remains with the parser.
+inline bool is_line_tcp_structural(uint8_t b) {
+    switch (b) {
+        case '\n':
+        case '\r':
+        case ' ':
+        case ',':
+        case '=':
+        case '"':
+        case '\\':
+        case '/':
+        case '\0':
+            return true;
+        default:
+            return b > 0x7f;
+    }
+}
+
+inline uint64_t line_tcp_structural_bits_vanilla(const uint8_t *p, int64_t len) {
+    uint64_t bits = 0;
+    for (int64_t i = 0; i < len; i++) {
+        bits |= static_cast<uint64_t>(is_line_tcp_structural(p[i])) << i;
+    }
+    return bits;
+}
+
+// Writes structural bitmap of len bytes starting at lo, one bit per byte and
+// 64 bytes per word. Bits past len in the last word are zero.
+DECLARE_DISPATCHER_TYPE(line_tcp_structural_scan, const uint8_t *lo, int64_t len, uint64_t *bitmap);
+
+#endif //QUESTDB_LINE_TCP_DISPATCH_H
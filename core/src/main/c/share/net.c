@@ -143,6 +143,24 @@ JNIEXPORT jint JNICALL Java_io_questdb_network_Net_send
     return com_questdb_network_Net_EOTHERDISCONNECT;
 }
 
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_sendv
+        (JNIEnv *e, jclass cl, jlong fd, jlong iov, jint iovCnt) {
+    // vector of (address, length) pairs has the same layout as struct iovec on 64-bit platforms
+    struct msghdr msg = {0};
+    msg.msg_iov = (struct iovec *) iov;
+    msg.msg_iovlen = iovCnt;
+    const ssize_t n = sendmsg((int) fd, &msg, 0);
+    if (n > -1) {
+        return n;
+    }
+
+    if (errno == EWOULDBLOCK) {
+        return com_questdb_network_Net_ERETRY;
+    }
+
+    return com_questdb_network_Net_EOTHERDISCONNECT;
+}
+
 JNIEXPORT jint JNICALL Java_io_questdb_network_Net_recv
         (JNIEnv *e, jclass cl, jlong fd, jlong ptr, jint len) {
     const ssize_t n = recv((int) fd, (void *) ptr, (size_t) len, 0);
@@ -278,6 +296,43 @@ JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setReusePort
     return setsockopt((int) fd, SOL_SOCKET, SO_REUSEPORT, &optval, sizeof(optval));
 }
 
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setBusyPoll
+        (JNIEnv *e, jclass cl, jlong fd, jint usec) {
+#ifdef SO_BUSY_POLL
+    if (set_int_sockopt((int) fd, SOL_SOCKET, SO_BUSY_POLL, usec) < 0) {
+        return -1;
+    }
+#ifdef SO_PREFER_BUSY_POLL
+    // preference to keep interrupts deferred is available since Linux 5.11, it is optional
+    set_int_sockopt((int) fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, usec > 0);
+#endif
+    return 0;
+#else
+    errno = ENOPROTOOPT;
+    return -1;
+#endif
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_getIncomingCpu
+        (JNIEnv *e, jclass cl, jlong fd) {
+#ifdef SO_INCOMING_CPU
+    return get_int_sockopt((int) fd, SOL_SOCKET, SO_INCOMING_CPU);
+#else
+    errno = ENOPROTOOPT;
+    return -1;
+#endif
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setIncomingCpu
+        (JNIEnv *e, jclass cl, jlong fd, jint cpu) {
+#ifdef SO_INCOMING_CPU
+    return set_int_sockopt((int) fd, SOL_SOCKET, SO_INCOMING_CPU, cpu);
+#else
+    errno = ENOPROTOOPT;
+    return -1;
+#endif
+}
+
 JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setTcpNoDelay
         (JNIEnv *e, jclass cl, jlong fd, jboolean noDelay) {
     return set_int_sockopt((int) fd, IPPROTO_TCP, TCP_NODELAY, noDelay);
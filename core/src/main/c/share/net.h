@@ -13,6 +13,10 @@ extern "C" {
 #define com_questdb_network_Net_EPEERDISCONNECT -1L
 #undef com_questdb_network_Net_EOTHERDISCONNECT
 #define com_questdb_network_Net_EOTHERDISCONNECT -2L
+#undef com_questdb_network_Net_EEOF
+#define com_questdb_network_Net_EEOF -3L
+#undef com_questdb_network_Net_MAX_IOV
+#define com_questdb_network_Net_MAX_IOV 16L
 /*
  * Class:     com_questdb_network_Net
  * Method:    abortAccept
@@ -141,6 +145,30 @@ JNIEXPORT jint JNICALL Java_io_questdb_network_Net_recv
 JNIEXPORT jint JNICALL Java_io_questdb_network_Net_recvmmsg
         (JNIEnv *, jclass, jlong, jlong, jint);
 
+/*
+ * Class:     com_questdb_network_Net
+ * Method:    recvmmsgSegments
+ * Signature: (JJIJI)I
+ */
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_recvmmsgSegments
+        (JNIEnv *, jclass, jlong, jlong, jint, jlong, jint);
+
+/*
+ * Class:     com_questdb_network_Net
+ * Method:    setUdpGro
+ * Signature: (JZ)I
+ */
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setUdpGro
+        (JNIEnv *, jclass, jlong, jboolean);
+
+/*
+ * Class:     com_questdb_network_Net
+ * Method:    setRxqOverflow
+ * Signature: (JZ)I
+ */
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setRxqOverflow
+        (JNIEnv *, jclass, jlong, jboolean);
+
 /*
  * Class:     com_questdb_network_Net
  * Method:    send
@@ -149,6 +177,22 @@ JNIEXPORT jint JNICALL Java_io_questdb_network_Net_recvmmsg
 JNIEXPORT jint JNICALL Java_io_questdb_network_Net_send
         (JNIEnv *, jclass, jlong, jlong, jint);
 
+/*
+ * Class:     com_questdb_network_Net
+ * Method:    sendFile
+ * Signature: (JJJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_io_questdb_network_Net_sendFile
+        (JNIEnv *, jclass, jlong, jlong, jlong, jlong);
+
+/*
+ * Class:     com_questdb_network_Net
+ * Method:    sendv
+ * Signature: (JJI)I
+ */
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_sendv
+        (JNIEnv *, jclass, jlong, jlong, jint);
+
 /*
  * Class:     com_questdb_network_Net
  * Method:    sendTo
@@ -229,6 +273,30 @@ JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setMulticastLoop
 JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setReuseAddress
         (JNIEnv *, jclass, jlong);
 
+/*
+ * Class:     com_questdb_network_Net
+ * Method:    setBusyPoll
+ * Signature: (JI)I
+ */
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setBusyPoll
+        (JNIEnv *, jclass, jlong, jint);
+
+/*
+ * Class:     com_questdb_network_Net
+ * Method:    getIncomingCpu
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_getIncomingCpu
+        (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_questdb_network_Net
+ * Method:    setIncomingCpu
+ * Signature: (JI)I
+ */
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setIncomingCpu
+        (JNIEnv *, jclass, jlong, jint);
+
 /*
  * Class:     com_questdb_network_Net
  * Method:    setReusePort
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <jni.h>
+#include "text_dispatch.h"
+
+extern "C" {
+
+DECLARE_DISPATCHER(text_structural_scan);
+
+JNIEXPORT void JNICALL
+Java_io_questdb_cutlass_text_TextLexerNative_structuralScan(
+        JNIEnv */*env*/,
+        jclass /*cl*/,
+        jlong lo,
+        jlong len,
+        jbyte delimiter,
+        jlong bitmap
+) {
+    text_structural_scan(
+            reinterpret_cast<const uint8_t *>(lo),
+            static_cast<int64_t>(len),
+            static_cast<uint8_t>(delimiter),
+            reinterpret_cast<uint64_t *>(bitmap)
+    );
+}
+
+} // extern "C"
@@ -0,0 +1,41 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "text_dispatch.h"
+
+void MULTI_VERSION_NAME (text_structural_scan)(const uint8_t *lo, int64_t len, uint8_t delimiter, uint64_t *bitmap) {
+    const Vec64c d(static_cast<int8_t>(delimiter));
+    int64_t i = 0;
+    int64_t w = 0;
+    for (; i + 64 <= len; i += 64) {
+        Vec64c v;
+        v.load(lo + i);
+        const Vec64cb m = (v == d) | (v == '"') | (v == '\n') | (v == '\r');
+        bitmap[w++] = to_bits(m);
+    }
+
+    if (i < len) {
+        bitmap[w] = text_structural_bits_vanilla(lo + i, len - i, delimiter);
+    }
+}
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#ifndef QUESTDB_TEXT_DISPATCH_H
+#define QUESTDB_TEXT_DISPATCH_H
+
+#include <cstdint>
+#include "dispatcher.h"
+
+// Bytes the text lexer has to look at one by one: column delimiter, quote and line ends.
+// Everything else is part of a field value and is skipped over in bulk.
+inline bool is_text_structural(uint8_t b, uint8_t delimiter) {
+    return b == delimiter || b == '"' || b == '\n' || b == '\r';
+}
+
+inline uint64_t text_structural_bits_vanilla(const uint8_t *p, int64_t len, uint8_t delimiter) {
+    uint64_t bits = 0;
+    for (int64_t i = 0; i < len; i++) {
+        bits |= static_cast<uint64_t>(is_text_structural(p[i], delimiter)) << i;
+    }
+    return bits;
+}
+
+// Writes structural bitmap of len bytes starting at lo, one bit per byte and
+// 64 bytes per word. Bits past len in the last word are zero.
+DECLARE_DISPATCHER_TYPE(text_structural_scan, const uint8_t *lo, int64_t len, uint8_t delimiter, uint64_t *bitmap);
+
+#endif //QUESTDB_TEXT_DISPATCH_H
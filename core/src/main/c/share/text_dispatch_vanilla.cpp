@@ -0,0 +1,8 @@
+#include "text_dispatch.h"
+
+void text_structural_scan(const uint8_t *lo, int64_t len, uint8_t delimiter, uint64_t *bitmap) {
+    int64_t w = 0;
+    for (int64_t i = 0; i < len; i += 64) {
+        bitmap[w++] = text_structural_bits_vanilla(lo + i, len - i < 64 ? len - i : 64, delimiter);
+    }
+}
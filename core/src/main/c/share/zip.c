@@ -82,11 +82,6 @@ JNIEXPORT void JNICALL Java_io_questdb_std_Zip_deflateEnd
     free(strm);
 }
 
-JNIEXPORT jint JNICALL Java_io_questdb_std_Zip_crc32
-        (JNIEnv *e, jclass cl, jint crc, jlong address, jint available) {
-    return (jint) crc32((uLong) crc, (const Bytef *) address, (uInt) available);
-}
-
 JNIEXPORT jlong JNICALL Java_io_questdb_std_Zip_inflateInit
         (JNIEnv *e, jclass cl, jboolean nowrap) {
 
@@ -51,6 +51,15 @@
 
 #include "deflate.h"
 
+/* Match length is found a word at a time on 64-bit little endian targets,
+ * output is identical to the byte at a time scan.
+ */
+#if !defined(UNALIGNED_OK) && defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && (defined(__x86_64__) || defined(__aarch64__))
+#  define WORD_MATCH
+typedef unsigned long long ulg64;
+#endif
+
 const char deflate_copyright[] =
    " deflate 1.2.8 Copyright 1995-2013 Jean-loup Gailly and Mark Adler ";
 /*
@@ -1253,6 +1262,25 @@ local uInt longest_match(s, cur_match)
         scan += 2, match++;
         Assert(*scan == *match, "match[2]?");
 
+#ifdef WORD_MATCH
+        /* Compare 8 bytes at a time, the first mismatching byte is located
+         * by the number of trailing zero bits of the difference. The 32nd
+         * word ends at strstart+258, so nothing beyond the bytes the byte
+         * loop below would read is touched.
+         */
+        scan++, match++;
+        do {
+            ulg64 sw, mw;
+            zmemcpy((Bytef*)&sw, scan, sizeof(sw));
+            zmemcpy((Bytef*)&mw, match, sizeof(mw));
+            if (sw != mw) {
+                scan += __builtin_ctzll(sw ^ mw) >> 3;
+                break;
+            }
+            scan += 8, match += 8;
+        } while (scan < strend);
+        if (scan > strend) scan = strend;
+#else
         /* We check for insufficient lookahead only every 8th comparison;
          * the 256th check will be made at strstart+258.
          */
@@ -1262,6 +1290,7 @@ local uInt longest_match(s, cur_match)
                  *++scan == *++match && *++scan == *++match &&
                  *++scan == *++match && *++scan == *++match &&
                  scan < strend);
+#endif
 
         Assert(scan <= s->window+(unsigned)(s->window_size-1), "wild scan");
 
@@ -424,7 +424,7 @@ JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_mmap0
     DWORD dwDesiredAccess;
     LPCVOID address;
 
-    if (flags == com_questdb_std_Files_MAP_RW) {
+    if ((flags & com_questdb_std_Files_MAP_RW) == com_questdb_std_Files_MAP_RW) {
         flProtect = PAGE_READWRITE;
         dwDesiredAccess = FILE_MAP_WRITE;
     } else {
@@ -465,6 +465,24 @@ JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_mmap0
     return (jlong) address;
 }
 
+JNIEXPORT jint JNICALL Java_io_questdb_std_Files_madvise0
+        (JNIEnv *e, jclass cl, jlong address, jlong len, jint advice) {
+    // access pattern hints are not supported, mapped views are left to the OS
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_openDirect0
+        (JNIEnv *e, jclass cl, jlong fd) {
+    // unbuffered I/O is not supported, callers fall back to regular writes
+    return -1;
+}
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_mmapReserve0
+        (JNIEnv *e, jclass cl, jlong len, jlong baseAddress) {
+    // views cannot be placed over reserved range, callers fall back to remapping
+    return -1;
+}
+
 static inline jlong internal_mremap0
         (jlong fd, jlong address, jlong previousLen, jlong newLen, jlong offset, jint flags) {
     jlong newAddress = Java_io_questdb_std_Files_mmap0((JNIEnv *) NULL, (jclass) NULL, fd, newLen, offset, flags, 0);
@@ -594,6 +612,100 @@ JNIEXPORT jint JNICALL Java_io_questdb_std_Files_findType
            com_questdb_std_Files_DT_DIR : com_questdb_std_Files_DT_REG;
 }
 
+typedef struct {
+    HANDLE hFind;
+    WIN32_FIND_DATAW findData;
+    // find data holds entry that is yet to be returned
+    BOOL pending;
+} SCAN_DIR;
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_scanDirOpen0
+        (JNIEnv *e, jclass cl, jlong lpszName) {
+
+    char path[strlen((const char *) lpszName) + 32];
+    sprintf(path, "%s\\*.*", (char *) lpszName);
+
+    int len = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
+    if (len > 0) {
+        wchar_t buf[len];
+        MultiByteToWideChar(CP_UTF8, 0, path, -1, buf, len);
+
+        SCAN_DIR *scan = malloc(sizeof(SCAN_DIR));
+        if (scan == NULL) {
+            SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+            SaveLastError();
+            return -1;
+        }
+        scan->hFind = FindFirstFileExW(buf, FindExInfoBasic, &scan->findData, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+        if (scan->hFind == INVALID_HANDLE_VALUE) {
+            SaveLastError();
+            DWORD err = GetLastError();
+            free(scan);
+            return err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND ? 0 : -1;
+        }
+        scan->pending = TRUE;
+        return (jlong) scan;
+    }
+    // path is not valid UTF-8
+    SaveLastError();
+    return -1;
+}
+
+JNIEXPORT jlong JNICALL Java_io_questdb_std_Files_scanDirNext
+        (JNIEnv *e, jclass cl, jlong scanPtr, jlong address, jlong len, jint flags) {
+    SCAN_DIR *scan = (SCAN_DIR *) scanPtr;
+    char *out = (char *) address;
+    jlong written = 0;
+    char utf8Name[UTF8_MAX_PATH];
+
+    while (1) {
+        if (!scan->pending) {
+            if (!FindNextFileW(scan->hFind, &scan->findData)) {
+                if (GetLastError() == ERROR_NO_MORE_FILES) {
+                    return written;
+                }
+                SaveLastError();
+                return written > 0 ? written : -1;
+            }
+            scan->pending = TRUE;
+        }
+
+        const int nameLen = WideCharToMultiByte(CP_UTF8, 0, scan->findData.cFileName, -1, utf8Name, UTF8_MAX_PATH, NULL, NULL);
+        // name length includes terminating zero
+        const jlong recordLen = (jlong) ((com_questdb_std_Files_SCAN_DIR_NAME_OFFSET + nameLen + 7) & ~7);
+        if (written + recordLen > len) {
+            if (written == 0) {
+                SetLastError(ERROR_INSUFFICIENT_BUFFER);
+                SaveLastError();
+                return -1;
+            }
+            return written;
+        }
+
+        char *rec = out + written;
+        *(jint *) rec = (jint) recordLen;
+        // find data has file size at hand, it is reported regardless of the stat flag
+        if (scan->findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            *(jint *) (rec + com_questdb_std_Files_SCAN_DIR_TYPE_OFFSET) = com_questdb_std_Files_DT_DIR;
+            *(jlong *) (rec + com_questdb_std_Files_SCAN_DIR_SIZE_OFFSET) = -1;
+        } else {
+            *(jint *) (rec + com_questdb_std_Files_SCAN_DIR_TYPE_OFFSET) = com_questdb_std_Files_DT_REG;
+            *(jlong *) (rec + com_questdb_std_Files_SCAN_DIR_SIZE_OFFSET) =
+                    ((jlong) scan->findData.nFileSizeHigh << 32) | scan->findData.nFileSizeLow;
+        }
+        memcpy(rec + com_questdb_std_Files_SCAN_DIR_NAME_OFFSET, utf8Name, nameLen);
+        written += recordLen;
+        scan->pending = FALSE;
+    }
+}
+
+JNIEXPORT void JNICALL Java_io_questdb_std_Files_scanDirClose
+        (JNIEnv *e, jclass cl, jlong scanPtr) {
+    SCAN_DIR *scan = (SCAN_DIR *) scanPtr;
+    FindClose(scan->hFind);
+    free(scan);
+}
+
 JNIEXPORT jint JNICALL Java_io_questdb_std_Files_lock
         (JNIEnv *e, jclass cl, jlong fd) {
     if (LockFile((HANDLE) fd, 0, 0, 1, 0)) {
@@ -264,6 +264,31 @@ JNIEXPORT jint JNICALL Java_io_questdb_network_Net_send
     return com_questdb_network_Net_EOTHERDISCONNECT;
 }
 
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_sendv
+        (JNIEnv *e, jclass cl, jlong fd, jlong iov, jint iovCnt) {
+    WSABUF buffers[com_questdb_network_Net_MAX_IOV];
+    if (iovCnt > com_questdb_network_Net_MAX_IOV) {
+        iovCnt = com_questdb_network_Net_MAX_IOV;
+    }
+    const jlong *pairs = (const jlong *) iov;
+    for (int i = 0; i < iovCnt; i++) {
+        buffers[i].buf = (CHAR *) pairs[2 * i];
+        buffers[i].len = (ULONG) pairs[2 * i + 1];
+    }
+
+    DWORD n;
+    if (WSASend((SOCKET) fd, buffers, (DWORD) iovCnt, &n, 0, NULL, NULL) == 0) {
+        return (jint) n;
+    }
+
+    if (WSAGetLastError() == WSAEWOULDBLOCK) {
+        return com_questdb_network_Net_ERETRY;
+    }
+
+    SaveLastError();
+    return com_questdb_network_Net_EOTHERDISCONNECT;
+}
+
 JNIEXPORT jint JNICALL Java_io_questdb_network_Net_sendTo
         (JNIEnv *e, jclass cl, jlong fd, jlong ptr, jint len, jlong sockaddr) {
     int result = sendto((SOCKET) fd, (const void *) ptr, len, 0, (const struct sockaddr *) sockaddr,
@@ -349,6 +374,27 @@ JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setReusePort
     return set_int_sockopt((SOCKET) fd, SOL_SOCKET, SO_REUSEADDR, 1);
 }
 
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setBusyPoll
+        (JNIEnv *e, jclass cl, jlong fd, jint usec) {
+    WSASetLastError(WSAENOPROTOOPT);
+    SaveLastError();
+    return -1;
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_getIncomingCpu
+        (JNIEnv *e, jclass cl, jlong fd) {
+    WSASetLastError(WSAENOPROTOOPT);
+    SaveLastError();
+    return -1;
+}
+
+JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setIncomingCpu
+        (JNIEnv *e, jclass cl, jlong fd, jint cpu) {
+    WSASetLastError(WSAENOPROTOOPT);
+    SaveLastError();
+    return -1;
+}
+
 JNIEXPORT jint JNICALL Java_io_questdb_network_Net_setMulticastLoop
         (JNIEnv *e, jclass cl, jlong fd, jboolean loop) {
     int result = setsockopt((SOCKET) fd, IPPROTO_IP, IP_MULTICAST_LOOP, (const char *) &loop, sizeof(loop));
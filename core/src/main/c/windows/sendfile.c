@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <jni.h>
+#include <winsock2.h>
+#include "../share/net.h"
+#include "errno.h"
+
+// TransmitFile() blocks on non-blocking sockets, file is relayed through a buffer instead
+#define SEND_FILE_BUF_SIZE 65536
+
+JNIEXPORT jlong JNICALL Java_io_questdb_network_Net_sendFile
+        (JNIEnv *e, jclass cl, jlong fd, jlong sockFd, jlong offset, jlong len) {
+    char buf[SEND_FILE_BUF_SIZE];
+    OVERLAPPED overlapped = {0};
+    overlapped.Offset = (DWORD) (offset & 0xFFFFFFFF);
+    overlapped.OffsetHigh = (DWORD) (offset >> 32);
+
+    DWORD count;
+    const DWORD toRead = len < SEND_FILE_BUF_SIZE ? (DWORD) len : SEND_FILE_BUF_SIZE;
+    if (!ReadFile((HANDLE) fd, buf, toRead, &count, &overlapped)) {
+        SaveLastError();
+        return com_questdb_network_Net_EOTHERDISCONNECT;
+    }
+
+    if (count == 0) {
+        return len > 0 ? com_questdb_network_Net_EEOF : 0;
+    }
+
+    const int n = send((SOCKET) sockFd, buf, (int) count, 0);
+    if (n > -1) {
+        return n;
+    }
+
+    if (WSAGetLastError() == WSAEWOULDBLOCK) {
+        return com_questdb_network_Net_ERETRY;
+    }
+
+    SaveLastError();
+    return com_questdb_network_Net_EOTHERDISCONNECT;
+}
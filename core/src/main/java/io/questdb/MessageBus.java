@@ -33,6 +33,12 @@ import java.io.Closeable;
 
 public interface MessageBus extends Closeable {
 
+    MPSequence getColumnFilePoolPubSeq();
+
+    RingQueue<ColumnFilePoolTask> getColumnFilePoolQueue();
+
+    MCSequence getColumnFilePoolSubSeq();
+
     CairoConfiguration getConfiguration();
 
     Sequence getIndexerPubSequence();
@@ -87,6 +93,18 @@ public interface MessageBus extends Closeable {
 
     MCSequence getPageFrameReduceSubSeq(int shard);
 
+    MPSequence getPartitionChecksumPubSeq();
+
+    RingQueue<PartitionChecksumTask> getPartitionChecksumQueue();
+
+    MCSequence getPartitionChecksumSubSeq();
+
+    MPSequence getPrefetchPubSeq();
+
+    RingQueue<PrefetchTask> getPrefetchQueue();
+
+    MCSequence getPrefetchSubSeq();
+
     FanOut getTableWriterEventFanOut();
 
     MPSequence getTableWriterEventPubSeq();
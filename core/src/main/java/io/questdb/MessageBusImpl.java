@@ -35,6 +35,10 @@ import org.jetbrains.annotations.NotNull;
 public class MessageBusImpl implements MessageBus {
     private final CairoConfiguration configuration;
 
+    private final RingQueue<ColumnFilePoolTask> columnFilePoolQueue;
+    private final MPSequence columnFilePoolPubSeq;
+    private final MCSequence columnFilePoolSubSeq;
+
     private final RingQueue<ColumnIndexerTask> indexerQueue;
     private final MPSequence indexerPubSeq;
     private final MCSequence indexerSubSeq;
@@ -67,6 +71,14 @@ public class MessageBusImpl implements MessageBus {
     private final MPSequence latestByPubSeq;
     private final MCSequence latestBySubSeq;
 
+    private final RingQueue<PartitionChecksumTask> partitionChecksumQueue;
+    private final MPSequence partitionChecksumPubSeq;
+    private final MCSequence partitionChecksumSubSeq;
+
+    private final RingQueue<PrefetchTask> prefetchQueue;
+    private final MPSequence prefetchPubSeq;
+    private final MCSequence prefetchSubSeq;
+
     private final RingQueue<TableWriterTask> tableWriterEventQueue;
     private final MPSequence tableWriterEventPubSeq;
     private final FanOut tableWriterEventSubSeq;
@@ -82,6 +94,11 @@ public class MessageBusImpl implements MessageBus {
 
     public MessageBusImpl(@NotNull CairoConfiguration configuration) {
         this.configuration = configuration;
+        this.columnFilePoolQueue = new RingQueue<>(ColumnFilePoolTask::new, configuration.getWriterFilePoolQueueCapacity());
+        this.columnFilePoolPubSeq = new MPSequence(columnFilePoolQueue.getCycle());
+        this.columnFilePoolSubSeq = new MCSequence(columnFilePoolQueue.getCycle());
+        columnFilePoolPubSeq.then(columnFilePoolSubSeq).then(columnFilePoolPubSeq);
+
         this.indexerQueue = new RingQueue<>(ColumnIndexerTask::new, configuration.getColumnIndexerQueueCapacity());
         this.indexerPubSeq = new MPSequence(indexerQueue.getCycle());
         this.indexerSubSeq = new MCSequence(indexerQueue.getCycle());
@@ -122,6 +139,16 @@ public class MessageBusImpl implements MessageBus {
         this.latestBySubSeq = new MCSequence(latestByQueue.getCycle());
         latestByPubSeq.then(latestBySubSeq).then(latestByPubSeq);
 
+        this.partitionChecksumQueue = new RingQueue<>(PartitionChecksumTask::new, configuration.getPartitionChecksumQueueCapacity());
+        this.partitionChecksumPubSeq = new MPSequence(partitionChecksumQueue.getCycle());
+        this.partitionChecksumSubSeq = new MCSequence(partitionChecksumQueue.getCycle());
+        partitionChecksumPubSeq.then(partitionChecksumSubSeq).then(partitionChecksumPubSeq);
+
+        this.prefetchQueue = new RingQueue<>(PrefetchTask::new, configuration.getPrefetchQueueCapacity());
+        this.prefetchPubSeq = new MPSequence(prefetchQueue.getCycle());
+        this.prefetchSubSeq = new MCSequence(prefetchQueue.getCycle());
+        prefetchPubSeq.then(prefetchSubSeq).then(prefetchPubSeq);
+
         this.tableWriterEventQueue = new RingQueue<>(
                 TableWriterTask::new,
                 configuration.getWriterCommandQueueSlotSize(),
@@ -170,6 +197,21 @@ public class MessageBusImpl implements MessageBus {
         Misc.free(pageFrameReduceQueue);
     }
 
+    @Override
+    public MPSequence getColumnFilePoolPubSeq() {
+        return columnFilePoolPubSeq;
+    }
+
+    @Override
+    public RingQueue<ColumnFilePoolTask> getColumnFilePoolQueue() {
+        return columnFilePoolQueue;
+    }
+
+    @Override
+    public MCSequence getColumnFilePoolSubSeq() {
+        return columnFilePoolSubSeq;
+    }
+
     @Override
     public CairoConfiguration getConfiguration() {
         return configuration;
@@ -305,6 +347,36 @@ public class MessageBusImpl implements MessageBus {
         return pageFrameReduceSubSeq[shard];
     }
 
+    @Override
+    public MPSequence getPartitionChecksumPubSeq() {
+        return partitionChecksumPubSeq;
+    }
+
+    @Override
+    public RingQueue<PartitionChecksumTask> getPartitionChecksumQueue() {
+        return partitionChecksumQueue;
+    }
+
+    @Override
+    public MCSequence getPartitionChecksumSubSeq() {
+        return partitionChecksumSubSeq;
+    }
+
+    @Override
+    public MPSequence getPrefetchPubSeq() {
+        return prefetchPubSeq;
+    }
+
+    @Override
+    public RingQueue<PrefetchTask> getPrefetchQueue() {
+        return prefetchQueue;
+    }
+
+    @Override
+    public MCSequence getPrefetchSubSeq() {
+        return prefetchSubSeq;
+    }
+
     @Override
     public FanOut getTableWriterEventFanOut() {
         return tableWriterEventSubSeq;
@@ -27,6 +27,7 @@ package io.questdb;
 import io.questdb.cairo.TableWriterMetrics;
 import io.questdb.cutlass.http.processors.HealthCheckMetrics;
 import io.questdb.cutlass.http.processors.JsonQueryMetrics;
+import io.questdb.cutlass.line.udp.LineUdpMetrics;
 import io.questdb.metrics.MetricsRegistry;
 import io.questdb.metrics.MetricsRegistryImpl;
 import io.questdb.metrics.NullMetricsRegistry;
@@ -40,6 +41,7 @@ public class Metrics implements Scrapable {
     private final JsonQueryMetrics jsonQuery;
     private final HealthCheckMetrics healthCheck;
     private final TableWriterMetrics tableWriter;
+    private final LineUdpMetrics lineUdp;
     private final MetricsRegistry metricsRegistry;
 
     Metrics(boolean enabled, MetricsRegistry metricsRegistry) {
@@ -47,6 +49,7 @@ public class Metrics implements Scrapable {
         this.jsonQuery = new JsonQueryMetrics(metricsRegistry);
         this.healthCheck = new HealthCheckMetrics(metricsRegistry);
         this.tableWriter = new TableWriterMetrics(metricsRegistry);
+        this.lineUdp = new LineUdpMetrics(metricsRegistry);
         createMemoryGauges(metricsRegistry);
         this.metricsRegistry = metricsRegistry;
     }
@@ -86,6 +89,10 @@ public class Metrics implements Scrapable {
         return tableWriter;
     }
 
+    public LineUdpMetrics lineUdp() {
+        return lineUdp;
+    }
+
     @Override
     public void scrapeIntoPrometheus(CharSink sink) {
         metricsRegistry.scrapeIntoPrometheus(sink);
@@ -130,6 +130,9 @@ public class PropServerConfiguration implements ServerConfiguration {
     private final int lineUdpMsgBufferSize;
     private final int lineUdpMsgCount;
     private final int lineUdpReceiveBufferSize;
+    private final int lineUdpReceiveBufferMaxSize;
+    private final boolean lineUdpGroEnabled;
+    private final int lineUdpShardCount;
     private final int lineUdpCommitMode;
     private final int[] sharedWorkerAffinity;
     private final int sharedWorkerCount;
@@ -225,6 +228,18 @@ public class PropServerConfiguration implements ServerConfiguration {
     private final long instanceHashHi;
     private final int sqlTxnScoreboardEntryCount;
     private final boolean o3QuickSortEnabled;
+    private final boolean readerMadviseEnabled;
+    private final int prefetchQueueCapacity;
+    private final int readerPrefetchDistance;
+    private final boolean writerDirectIoEnabled;
+    private final long writerDirectIoBufferSize;
+    private final boolean writerBatchSyncEnabled;
+    private final long writerMmapReserveSize;
+    private final boolean partitionChecksumEnabled;
+    private final long partitionChecksumIoBudget;
+    private final int partitionChecksumQueueCapacity;
+    private final int writerFilePoolCapacity;
+    private final int writerFilePoolQueueCapacity;
     private final MetricsConfiguration metricsConfiguration = new PropMetricsConfiguration();
     private final boolean metricsEnabled;
     private final int sqlDistinctTimestampKeyCapacity;
@@ -269,10 +284,12 @@ public class PropServerConfiguration implements ServerConfiguration {
     private long httpWorkerSleepMs;
     private boolean httpServerKeepAlive;
     private int sendBufferSize;
+    private int responseHeaderBufferSize;
     private CharSequence indexFileName;
     private String publicDirectory;
     private int httpNetConnectionLimit;
     private boolean httpNetConnectionHint;
+    private boolean httpNetIOURingEnabled;
     private long httpNetConnectionTimeout;
     private long httpNetConnectionQueueTimeout;
     private int httpNetConnectionSndBuf;
@@ -305,6 +322,7 @@ public class PropServerConfiguration implements ServerConfiguration {
     private boolean interruptOnClosedConnection;
     private int pgNetConnectionLimit;
     private boolean pgNetConnectionHint;
+    private boolean pgNetIOURingEnabled;
     private int pgNetBindIPv4Address;
     private int pgNetBindPort;
     private long pgNetIdleConnectionTimeout;
@@ -340,6 +358,9 @@ public class PropServerConfiguration implements ServerConfiguration {
     private int pgPendingWritersCacheCapacity;
     private int lineTcpNetConnectionLimit;
     private boolean lineTcpNetConnectionHint;
+    private boolean lineTcpNetIOURingEnabled;
+    private int lineTcpNetBusyPollUsec;
+    private boolean lineTcpNetListenerPerWorkerEnabled;
     private int lineTcpNetBindIPv4Address;
     private int lineTcpNetBindPort;
     private long lineTcpNetConnectionTimeout;
@@ -493,6 +514,7 @@ public class PropServerConfiguration implements ServerConfiguration {
                 this.httpWorkerSleepThreshold = getLong(properties, env, PropertyKey.HTTP_WORKER_SLEEP_THRESHOLD, 10000);
                 this.httpWorkerSleepMs = getLong(properties, env, PropertyKey.HTTP_WORKER_SLEEP_MS, 100);
                 this.sendBufferSize = getIntSize(properties, env, PropertyKey.HTTP_SEND_BUFFER_SIZE, 2 * 1024 * 1024);
+                this.responseHeaderBufferSize = getIntSize(properties, env, PropertyKey.HTTP_RESPONSE_HEADER_BUFFER_SIZE, sendBufferSize);
                 this.indexFileName = getString(properties, env, PropertyKey.HTTP_STATIC_INDEX_FILE_NAME, "index.html");
                 this.httpFrozenClock = getBoolean(properties, env, PropertyKey.HTTP_FROZEN_CLOCK, false);
                 this.httpAllowDeflateBeforeSend = getBoolean(properties, env, PropertyKey.HTTP_ALLOW_DEFLATE_BEFORE_SEND, false);
@@ -524,6 +546,7 @@ public class PropServerConfiguration implements ServerConfiguration {
                 this.httpNetConnectionLimit = getInt(properties, env, PropertyKey.HTTP_NET_ACTIVE_CONNECTION_LIMIT, 256);
                 this.httpNetConnectionLimit = getInt(properties, env, PropertyKey.HTTP_NET_CONNECTION_LIMIT, this.httpNetConnectionLimit);
                 this.httpNetConnectionHint = getBoolean(properties, env, PropertyKey.HTTP_NET_CONNECTION_HINT, false);
+                this.httpNetIOURingEnabled = getBoolean(properties, env, PropertyKey.HTTP_NET_IO_URING_ENABLED, false);
                 // deprecated
                 this.httpNetConnectionTimeout = getLong(properties, env, PropertyKey.HTTP_NET_IDLE_CONNECTION_TIMEOUT, 5 * 60 * 1000L);
                 this.httpNetConnectionTimeout = getLong(properties, env, PropertyKey.HTTP_NET_CONNECTION_TIMEOUT, this.httpNetConnectionTimeout);
@@ -587,6 +610,7 @@ public class PropServerConfiguration implements ServerConfiguration {
                 pgNetConnectionLimit = getInt(properties, env, PropertyKey.PG_NET_ACTIVE_CONNECTION_LIMIT, 10);
                 pgNetConnectionLimit = getInt(properties, env, PropertyKey.PG_NET_CONNECTION_LIMIT, pgNetConnectionLimit);
                 pgNetConnectionHint = getBoolean(properties, env, PropertyKey.PG_NET_CONNECTION_HINT, false);
+                pgNetIOURingEnabled = getBoolean(properties, env, PropertyKey.PG_NET_IO_URING_ENABLED, false);
                 parseBindTo(properties, env, PropertyKey.PG_NET_BIND_TO, "0.0.0.0:8812", (a, p) -> {
                     pgNetBindIPv4Address = a;
                     pgNetBindPort = p;
@@ -772,6 +796,18 @@ public class PropServerConfiguration implements ServerConfiguration {
             this.maxUncommittedRows = getInt(properties, env, PropertyKey.CAIRO_MAX_UNCOMMITTED_ROWS, 500_000);
             this.commitLag = getLong(properties, env, PropertyKey.CAIRO_COMMIT_LAG, 300_000) * 1_000;
             this.o3QuickSortEnabled = getBoolean(properties, env, PropertyKey.CAIRO_O3_QUICKSORT_ENABLED, false);
+            this.readerMadviseEnabled = getBoolean(properties, env, PropertyKey.CAIRO_READER_MADVISE_ENABLED, false);
+            this.prefetchQueueCapacity = Numbers.ceilPow2(getInt(properties, env, PropertyKey.CAIRO_PREFETCH_QUEUE_CAPACITY, 64));
+            this.readerPrefetchDistance = getInt(properties, env, PropertyKey.CAIRO_READER_PREFETCH_DISTANCE, 0);
+            this.writerDirectIoEnabled = getBoolean(properties, env, PropertyKey.CAIRO_WRITER_DIRECT_IO_ENABLED, false);
+            this.writerDirectIoBufferSize = getLongSize(properties, env, PropertyKey.CAIRO_WRITER_DIRECT_IO_BUFFER_SIZE, 1024 * 1024);
+            this.writerBatchSyncEnabled = getBoolean(properties, env, PropertyKey.CAIRO_WRITER_BATCH_SYNC_ENABLED, false);
+            this.writerMmapReserveSize = getLongSize(properties, env, PropertyKey.CAIRO_WRITER_MMAP_RESERVE_SIZE, 0);
+            this.partitionChecksumEnabled = getBoolean(properties, env, PropertyKey.CAIRO_PARTITION_CHECKSUM_ENABLED, false);
+            this.partitionChecksumIoBudget = getLongSize(properties, env, PropertyKey.CAIRO_PARTITION_CHECKSUM_IO_BUDGET, 64 * 1024 * 1024);
+            this.partitionChecksumQueueCapacity = Numbers.ceilPow2(getInt(properties, env, PropertyKey.CAIRO_PARTITION_CHECKSUM_QUEUE_CAPACITY, 64));
+            this.writerFilePoolCapacity = getInt(properties, env, PropertyKey.CAIRO_WRITER_FILE_POOL_CAPACITY, 0);
+            this.writerFilePoolQueueCapacity = Numbers.ceilPow2(getInt(properties, env, PropertyKey.CAIRO_WRITER_FILE_POOL_QUEUE_CAPACITY, 64));
             this.rndFunctionMemoryPageSize = Numbers.ceilPow2(getIntSize(properties, env, PropertyKey.CAIRO_RND_MEMORY_PAGE_SIZE, 8192));
             this.rndFunctionMemoryMaxPages = Numbers.ceilPow2(getInt(properties, env, PropertyKey.CAIRO_RND_MEMORY_MAX_PAGES, 128));
             this.sqlAnalyticStorePageSize = Numbers.ceilPow2(getIntSize(properties, env, PropertyKey.CAIRO_SQL_ANALYTIC_STORE_PAGE_SIZE, 1024 * 1024));
@@ -798,10 +834,16 @@ public class PropServerConfiguration implements ServerConfiguration {
             this.lineUdpMsgBufferSize = getIntSize(properties, env, PropertyKey.LINE_UDP_MSG_BUFFER_SIZE, 2048);
             this.lineUdpMsgCount = getInt(properties, env, PropertyKey.LINE_UDP_MSG_COUNT, 10_000);
             this.lineUdpReceiveBufferSize = getIntSize(properties, env, PropertyKey.LINE_UDP_RECEIVE_BUFFER_SIZE, 8 * 1024 * 1024);
+            this.lineUdpReceiveBufferMaxSize = getIntSize(properties, env, PropertyKey.LINE_UDP_RECEIVE_BUFFER_MAX_SIZE, 64 * 1024 * 1024);
+            this.lineUdpGroEnabled = getBoolean(properties, env, PropertyKey.LINE_UDP_GRO_ENABLED, false);
+            this.lineUdpShardCount = getInt(properties, env, PropertyKey.LINE_UDP_SHARD_COUNT, 1);
             this.lineUdpEnabled = getBoolean(properties, env, PropertyKey.LINE_UDP_ENABLED, true);
             this.lineUdpOwnThreadAffinity = getInt(properties, env, PropertyKey.LINE_UDP_OWN_THREAD_AFFINITY, -1);
             this.lineUdpOwnThread = getBoolean(properties, env, PropertyKey.LINE_UDP_OWN_THREAD, false);
             this.lineUdpUnicast = getBoolean(properties, env, PropertyKey.LINE_UDP_UNICAST, false);
+            if (lineUdpShardCount > 1 && (lineUdpOwnThread || !lineUdpUnicast)) {
+                log.advisory().$("line.udp.shard.count is ignored, shards require line.udp.unicast=true and line.udp.own.thread=false").$();
+            }
             this.lineUdpCommitMode = getCommitMode(properties, env, PropertyKey.LINE_UDP_COMMIT_MODE);
             this.lineUdpTimestampAdapter = getLineTimestampAdaptor(properties, env, PropertyKey.LINE_UDP_TIMESTAMP);
             String defaultUdpPartitionByProperty = getString(properties, env, PropertyKey.LINE_DEFAULT_PARTITION_BY, "DAY");
@@ -817,6 +859,9 @@ public class PropServerConfiguration implements ServerConfiguration {
                 lineTcpNetConnectionLimit = getInt(properties, env, PropertyKey.LINE_TCP_NET_ACTIVE_CONNECTION_LIMIT, 256);
                 lineTcpNetConnectionLimit = getInt(properties, env, PropertyKey.LINE_TCP_NET_CONNECTION_LIMIT, lineTcpNetConnectionLimit);
                 lineTcpNetConnectionHint = getBoolean(properties, env, PropertyKey.LINE_TCP_NET_CONNECTION_HINT, false);
+                lineTcpNetIOURingEnabled = getBoolean(properties, env, PropertyKey.LINE_TCP_NET_IO_URING_ENABLED, false);
+                lineTcpNetBusyPollUsec = getInt(properties, env, PropertyKey.LINE_TCP_NET_BUSY_POLL_USEC, 0);
+                lineTcpNetListenerPerWorkerEnabled = getBoolean(properties, env, PropertyKey.LINE_TCP_NET_LISTENER_PER_WORKER_ENABLED, false);
                 parseBindTo(properties, env, PropertyKey.LINE_TCP_NET_BIND_TO, "0.0.0.0:9009", (a, p) -> {
                     lineTcpNetBindIPv4Address = a;
                     lineTcpNetBindPort = p;
@@ -1403,6 +1448,11 @@ public class PropServerConfiguration implements ServerConfiguration {
             return httpNetConnectionHint;
         }
 
+        @Override
+        public boolean isIOURingEnabled() {
+            return httpNetIOURingEnabled;
+        }
+
         @Override
         public NetworkFacade getNetworkFacade() {
             return NetworkFacadeImpl.INSTANCE;
@@ -1662,6 +1712,11 @@ public class PropServerConfiguration implements ServerConfiguration {
             return requestHeaderBufferSize;
         }
 
+        @Override
+        public int getResponseHeaderBufferSize() {
+            return responseHeaderBufferSize;
+        }
+
         @Override
         public int getSendBufferSize() {
             return sendBufferSize;
@@ -2068,16 +2123,36 @@ public class PropServerConfiguration implements ServerConfiguration {
             return parallelIndexThreshold;
         }
 
+        @Override
+        public long getPartitionChecksumIoBudget() {
+            return partitionChecksumIoBudget;
+        }
+
+        @Override
+        public int getPartitionChecksumQueueCapacity() {
+            return partitionChecksumQueueCapacity;
+        }
+
         @Override
         public int getPartitionPurgeListCapacity() {
             return o3PartitionPurgeListCapacity;
         }
 
+        @Override
+        public int getPrefetchQueueCapacity() {
+            return prefetchQueueCapacity;
+        }
+
         @Override
         public int getReaderPoolMaxSegments() {
             return readerPoolMaxSegments;
         }
 
+        @Override
+        public int getReaderPrefetchDistance() {
+            return readerPrefetchDistance;
+        }
+
         @Override
         public int getRenameTableModelPoolCapacity() {
             return sqlRenameTableModelPoolCapacity;
@@ -2382,11 +2457,31 @@ public class PropServerConfiguration implements ServerConfiguration {
             return writerAsyncCommandQueueSlotSize;
         }
 
+        @Override
+        public long getWriterDirectIoBufferSize() {
+            return writerDirectIoBufferSize;
+        }
+
         @Override
         public long getWriterFileOpenOpts() {
             return writerFileOpenOpts;
         }
 
+        @Override
+        public int getWriterFilePoolCapacity() {
+            return writerFilePoolCapacity;
+        }
+
+        @Override
+        public int getWriterFilePoolQueueCapacity() {
+            return writerFilePoolQueueCapacity;
+        }
+
+        @Override
+        public long getWriterMmapReserveSize() {
+            return writerMmapReserveSize;
+        }
+
         @Override
         public int getWriterTickRowsCountMod() {
             return writerTickRowsCountMod;
@@ -2402,11 +2497,31 @@ public class PropServerConfiguration implements ServerConfiguration {
             return parallelIndexingEnabled;
         }
 
+        @Override
+        public boolean isPartitionChecksumEnabled() {
+            return partitionChecksumEnabled;
+        }
+
+        @Override
+        public boolean isReaderMadviseEnabled() {
+            return readerMadviseEnabled;
+        }
+
         @Override
         public boolean isSqlJitDebugEnabled() {
             return sqlJitDebugEnabled;
         }
 
+        @Override
+        public boolean isWriterBatchSyncEnabled() {
+            return writerBatchSyncEnabled;
+        }
+
+        @Override
+        public boolean isWriterDirectIoEnabled() {
+            return writerDirectIoEnabled;
+        }
+
         @Override
         public int getPageFrameReduceRowIdListCapacity() {
             return cairoPageFrameReduceRowIdListCapacity;
@@ -2479,6 +2594,21 @@ public class PropServerConfiguration implements ServerConfiguration {
             return lineUdpReceiveBufferSize;
         }
 
+        @Override
+        public int getReceiveBufferMaxSize() {
+            return lineUdpReceiveBufferMaxSize;
+        }
+
+        @Override
+        public int getShardCount() {
+            return lineUdpShardCount;
+        }
+
+        @Override
+        public boolean isGroEnabled() {
+            return lineUdpGroEnabled;
+        }
+
         @Override
         public CairoSecurityContext getCairoSecurityContext() {
             return AllowAllCairoSecurityContext.INSTANCE;
@@ -2572,6 +2702,16 @@ public class PropServerConfiguration implements ServerConfiguration {
             return lineTcpNetConnectionHint;
         }
 
+        @Override
+        public boolean isIOURingEnabled() {
+            return lineTcpNetIOURingEnabled;
+        }
+
+        @Override
+        public int getBusyPollUsec() {
+            return lineTcpNetBusyPollUsec;
+        }
+
         public NetworkFacade getNetworkFacade() {
             return NetworkFacadeImpl.INSTANCE;
         }
@@ -2768,6 +2908,11 @@ public class PropServerConfiguration implements ServerConfiguration {
             return lineTcpEnabled;
         }
 
+        @Override
+        public boolean isListenerPerWorkerEnabled() {
+            return lineTcpNetListenerPerWorkerEnabled;
+        }
+
         @Override
         public boolean getDisconnectOnError() {
             return lineTcpDisconnectOnError;
@@ -2948,6 +3093,11 @@ public class PropServerConfiguration implements ServerConfiguration {
             return pgNetConnectionHint;
         }
 
+        @Override
+        public boolean isIOURingEnabled() {
+            return pgNetIOURingEnabled;
+        }
+
         @Override
         public NetworkFacade getNetworkFacade() {
             return NetworkFacadeImpl.INSTANCE;
@@ -142,6 +142,18 @@ public enum PropertyKey {
     CAIRO_MAX_UNCOMMITTED_ROWS("cairo.max.uncommitted.rows"),
     CAIRO_COMMIT_LAG("cairo.commit.lag"),
     CAIRO_O3_QUICKSORT_ENABLED("cairo.o3.quicksort.enabled"),
+    CAIRO_READER_MADVISE_ENABLED("cairo.reader.madvise.enabled"),
+    CAIRO_PREFETCH_QUEUE_CAPACITY("cairo.prefetch.queue.capacity"),
+    CAIRO_READER_PREFETCH_DISTANCE("cairo.reader.prefetch.distance"),
+    CAIRO_WRITER_DIRECT_IO_ENABLED("cairo.writer.direct.io.enabled"),
+    CAIRO_WRITER_DIRECT_IO_BUFFER_SIZE("cairo.writer.direct.io.buffer.size"),
+    CAIRO_WRITER_BATCH_SYNC_ENABLED("cairo.writer.batch.sync.enabled"),
+    CAIRO_WRITER_MMAP_RESERVE_SIZE("cairo.writer.mmap.reserve.size"),
+    CAIRO_PARTITION_CHECKSUM_ENABLED("cairo.partition.checksum.enabled"),
+    CAIRO_PARTITION_CHECKSUM_IO_BUDGET("cairo.partition.checksum.io.budget"),
+    CAIRO_PARTITION_CHECKSUM_QUEUE_CAPACITY("cairo.partition.checksum.queue.capacity"),
+    CAIRO_WRITER_FILE_POOL_CAPACITY("cairo.writer.file.pool.capacity"),
+    CAIRO_WRITER_FILE_POOL_QUEUE_CAPACITY("cairo.writer.file.pool.queue.capacity"),
     CAIRO_RND_MEMORY_PAGE_SIZE("cairo.rnd.memory.page.size"),
     CAIRO_RND_MEMORY_MAX_PAGES("cairo.rnd.memory.max.pages"),
     CAIRO_SQL_ANALYTIC_STORE_PAGE_SIZE("cairo.sql.analytic.store.page.size"),
@@ -179,6 +191,7 @@ public enum PropertyKey {
     HTTP_MULTIPART_IDLE_SPIN_COUNT("http.multipart.idle.spin.count"),
     HTTP_RECEIVE_BUFFER_SIZE("http.receive.buffer.size"),
     HTTP_REQUEST_HEADER_BUFFER_SIZE("http.request.header.buffer.size"),
+    HTTP_RESPONSE_HEADER_BUFFER_SIZE("http.response.header.buffer.size"),
     HTTP_WORKER_AFFINITY("http.worker.affinity"),
     HTTP_WORKER_HALT_ON_ERROR("http.worker.haltOnError"),
     HTTP_WORKER_YIELD_THRESHOLD("http.worker.yield.threshold"),
@@ -192,6 +205,7 @@ public enum PropertyKey {
     HTTP_VERSION("http.version"),
     HTTP_STATIC_PUBLIC_DIRECTORY("http.static.public.directory"),
     HTTP_NET_CONNECTION_HINT("http.net.connection.hint"),
+    HTTP_NET_IO_URING_ENABLED("http.net.io.uring.enabled"),
     HTTP_NET_IDLE_CONNECTION_TIMEOUT("http.net.idle.connection.timeout"),
     HTTP_NET_CONNECTION_TIMEOUT("http.net.connection.timeout"),
     HTTP_NET_QUEUED_CONNECTION_TIMEOUT("http.net.queued.connection.timeout"),
@@ -243,6 +257,9 @@ public enum PropertyKey {
     LINE_UDP_MSG_BUFFER_SIZE("line.udp.msg.buffer.size"),
     LINE_UDP_MSG_COUNT("line.udp.msg.count"),
     LINE_UDP_RECEIVE_BUFFER_SIZE("line.udp.receive.buffer.size"),
+    LINE_UDP_RECEIVE_BUFFER_MAX_SIZE("line.udp.receive.buffer.max.size"),
+    LINE_UDP_GRO_ENABLED("line.udp.gro.enabled"),
+    LINE_UDP_SHARD_COUNT("line.udp.shard.count"),
     LINE_UDP_ENABLED("line.udp.enabled"),
     LINE_UDP_OWN_THREAD_AFFINITY("line.udp.own.thread.affinity"),
     LINE_UDP_OWN_THREAD("line.udp.own.thread"),
@@ -253,6 +270,9 @@ public enum PropertyKey {
     LINE_TCP_NET_ACTIVE_CONNECTION_LIMIT("line.tcp.net.active.connection.limit"),
     LINE_TCP_NET_CONNECTION_LIMIT("line.tcp.net.connection.limit"),
     LINE_TCP_NET_CONNECTION_HINT("line.tcp.net.connection.hint"),
+    LINE_TCP_NET_IO_URING_ENABLED("line.tcp.net.io.uring.enabled"),
+    LINE_TCP_NET_BUSY_POLL_USEC("line.tcp.net.busy.poll.usec"),
+    LINE_TCP_NET_LISTENER_PER_WORKER_ENABLED("line.tcp.net.listener.per.worker.enabled"),
     LINE_TCP_NET_BIND_TO("line.tcp.net.bind.to"),
     LINE_TCP_NET_IDLE_TIMEOUT("line.tcp.net.idle.timeout"),
     LINE_TCP_NET_CONNECTION_TIMEOUT("line.tcp.net.connection.timeout"),
@@ -294,6 +314,7 @@ public enum PropertyKey {
     METRICS_ENABLED("metrics.enabled"),
     PG_ENABLED("pg.enabled"),
     PG_NET_CONNECTION_HINT("pg.net.connection.hint"),
+    PG_NET_IO_URING_ENABLED("pg.net.io.uring.enabled"),
     PG_NET_BIND_TO("pg.net.bind.to"),
     PG_NET_IDLE_TIMEOUT("pg.net.idle.timeout"),
     PG_NET_CONNECTION_TIMEOUT("pg.net.connection.timeout"),
@@ -26,6 +26,7 @@ package io.questdb.cairo;
 
 import io.questdb.cairo.sql.DataFrame;
 import io.questdb.cairo.sql.DataFrameCursor;
+import io.questdb.std.Files;
 import io.questdb.std.Misc;
 
 public abstract class AbstractFullDataFrameCursor implements DataFrameCursor {
@@ -33,6 +34,8 @@ public abstract class AbstractFullDataFrameCursor implements DataFrameCursor {
     protected TableReader reader;
     protected int partitionHi;
     protected int partitionIndex;
+    private int advisedPartitionIndex = -1;
+    private int prefetchedPartitionIndex = -1;
 
     @Override
     public void close() {
@@ -65,10 +68,53 @@ public abstract class AbstractFullDataFrameCursor implements DataFrameCursor {
     public DataFrameCursor of(TableReader reader) {
         this.reader = reader;
         this.partitionHi = reader.getPartitionCount();
+        this.advisedPartitionIndex = -1;
+        this.prefetchedPartitionIndex = -1;
         toTop();
         return this;
     }
 
+    /**
+     * Hints OS on the partition scan is about to enter. Pages of the partition
+     * scan is leaving are deactivated, so that they are the first to be reclaimed
+     * instead of the hot working set of other queries.
+     *
+     * @param partitionIndex index of partition that will be scanned next
+     * @param advice         access pattern of the scan
+     */
+    protected void advisePartition(int partitionIndex, int advice) {
+        if (advisedPartitionIndex != -1 && advisedPartitionIndex != partitionIndex) {
+            reader.advisePartition(advisedPartitionIndex, Files.MADV_COLD);
+        }
+        reader.advisePartition(partitionIndex, advice);
+        advisedPartitionIndex = partitionIndex;
+    }
+
+    /**
+     * Queues read-ahead of partitions the scan is going to reach next, keeping up to
+     * the configured number of partitions in flight ahead of the current one.
+     *
+     * @param partitionIndex index of partition scan is entering
+     * @param step           scan direction, 1 for forward and -1 for backward scans
+     */
+    protected void prefetchPartitions(int partitionIndex, int step) {
+        final int distance = reader.getPrefetchDistance();
+        if (distance > 0) {
+            final int hi = partitionIndex + step * distance;
+            int i = partitionIndex + step;
+            // continue where previous call left off, unless the scan was rewound
+            if (prefetchedPartitionIndex != -1
+                    && (prefetchedPartitionIndex - partitionIndex) * step > 0
+                    && (hi - prefetchedPartitionIndex) * step >= 0) {
+                i = prefetchedPartitionIndex + step;
+            }
+            for (; (hi - i) * step >= 0 && i > -1 && i < partitionHi; i += step) {
+                reader.prefetchPartition(i);
+                prefetchedPartitionIndex = i;
+            }
+        }
+    }
+
     protected class FullTableDataFrame implements DataFrame {
         protected long rowLo = 0;
         protected long rowHi;
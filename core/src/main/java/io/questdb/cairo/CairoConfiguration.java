@@ -200,8 +200,17 @@ public interface CairoConfiguration {
 
     int getParallelIndexThreshold();
 
+    /**
+     * @return number of bytes per second each worker reads when computing or verifying partition checksums, 0 for unlimited
+     */
+    long getPartitionChecksumIoBudget();
+
+    int getPartitionChecksumQueueCapacity();
+
     int getPartitionPurgeListCapacity();
 
+    int getPrefetchQueueCapacity();
+
     default Rnd getRandom() {
         Rnd rnd = RANDOM.get();
         if (rnd == null) {
@@ -215,6 +224,15 @@ public interface CairoConfiguration {
 
     int getReaderPoolMaxSegments();
 
+    /**
+     * Number of partitions full table scan reads ahead of the partition it is currently on.
+     * Read-ahead is done by the shared worker pool, so that query thread does not stall
+     * on page faults when it moves to the next partition.
+     *
+     * @return prefetch distance in partitions, 0 disables prefetch
+     */
+    int getReaderPrefetchDistance();
+
     int getRenameTableModelPoolCapacity();
 
     CharSequence getRoot(); // some folder with suffix env['cairo.root'] e.g. /.../db
@@ -342,16 +360,71 @@ public interface CairoConfiguration {
 
     long getWriterCommandQueueSlotSize();
 
+    long getWriterDirectIoBufferSize();
+
     long getWriterFileOpenOpts();
 
+    /**
+     * Number of column files each table writer keeps created and allocated ahead of time. Files of
+     * new partitions are taken from the pool by rename instead of being created and allocated on
+     * commit. Pool is topped up by the shared worker pool.
+     *
+     * @return number of pre-allocated files per table writer, 0 to disable the pool
+     */
+    int getWriterFilePoolCapacity();
+
+    int getWriterFilePoolQueueCapacity();
+
+    /**
+     * Size of virtual address range reserved for each symbol map file. Files are extended in place
+     * within the range, so that their address does not change and growth does not take mremap() calls.
+     *
+     * @return size of reserved range, 0 to remap files as they grow
+     */
+    long getWriterMmapReserveSize();
+
     int getWriterTickRowsCountMod();
 
     boolean isO3QuickSortEnabled();
 
     boolean isParallelIndexingEnabled();
 
+    /**
+     * When enabled, table writer schedules checksum of column data files of every partition it
+     * moves on from, or changes out of order, once the data is committed. Partitions that have
+     * checksums are verified when the writer is opened. Checksums are computed and verified by
+     * the shared worker pool.
+     *
+     * @return true if partitions are checksummed, see {@link PartitionChecksum}
+     */
+    boolean isPartitionChecksumEnabled();
+
+    /**
+     * When enabled, table reader advises OS on the access pattern of full table scans: partitions
+     * are read ahead as scan enters them and their pages are deactivated once scan moves on.
+     *
+     * @return true if madvise() hints are issued for mapped column files
+     */
+    boolean isReaderMadviseEnabled();
+
     boolean isSqlJitDebugEnabled();
 
+    /**
+     * When enabled, commits in {@link CommitMode#SYNC} mode flush all column files with a single
+     * batch of io_uring operations instead of msync() call per column. Ignored when io_uring is not available.
+     *
+     * @return true if column files are flushed in a batch
+     */
+    boolean isWriterBatchSyncEnabled();
+
+    /**
+     * When enabled, large blocks of out-of-order partition rewrites are written bypassing page cache.
+     * File systems that do not support direct I/O are detected at runtime and written to as usual.
+     *
+     * @return true if O3 copy uses direct I/O for large blocks
+     */
+    boolean isWriterDirectIoEnabled();
+
     SqlExecutionCircuitBreakerConfiguration getCircuitBreakerConfiguration();
 
     int getQueryCacheEventQueueCapacity();
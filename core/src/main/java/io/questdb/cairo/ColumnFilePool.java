@@ -0,0 +1,188 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.cairo;
+
+import io.questdb.MessageBus;
+import io.questdb.log.Log;
+import io.questdb.log.LogFactory;
+import io.questdb.mp.MPSequence;
+import io.questdb.std.*;
+import io.questdb.std.str.LPSZ;
+import io.questdb.std.str.Path;
+import io.questdb.std.str.StringSink;
+import io.questdb.tasks.ColumnFilePoolTask;
+
+import java.io.Closeable;
+
+/**
+ * Column files created and allocated ahead of time for new partitions of a table. Files
+ * are kept in table directory under temporary names and are moved into partition directory
+ * by rename, which takes file creation and disk space allocation off the commit path.
+ * <p>
+ * Files are taken by table writer thread. Pool is topped up asynchronously by
+ * {@link ColumnFilePoolJob}, when the job is not running, writer creates files as usual.
+ */
+public class ColumnFilePool implements Closeable {
+    public static final String FILE_NAME_PREFIX = "_pool.";
+    private static final Log LOG = LogFactory.getLog(ColumnFilePool.class);
+    private final FilesFacade ff;
+    private final MessageBus messageBus;
+    private final int capacity;
+    private final long fileSize;
+    // writer thread path
+    private final Path path;
+    // provisioning path, guarded by pool monitor
+    private final Path provisionPath;
+    private final int rootLen;
+    private final StringSink fileNameSink = new StringSink();
+    private final FindVisitor removeLeftoverFunc = this::removeLeftover;
+    // files with ids below this value are created and allocated
+    private volatile long readyId;
+    private volatile boolean provisioning;
+    // files between takenId and readyId are available to writer
+    private long takenId;
+    private volatile boolean closed;
+    // guarded by pool monitor
+    private boolean released;
+
+    public ColumnFilePool(CairoConfiguration configuration, MessageBus messageBus, CharSequence tableRoot) {
+        this.ff = configuration.getFilesFacade();
+        this.messageBus = messageBus;
+        this.capacity = configuration.getWriterFilePoolCapacity();
+        this.fileSize = configuration.getDataAppendPageSize();
+        this.path = new Path().of(tableRoot);
+        this.provisionPath = new Path().of(tableRoot);
+        this.rootLen = path.length();
+        // files left behind by previous writer that did not shut down cleanly
+        ff.iterateDir(path.$(), removeLeftoverFunc);
+        path.trimTo(rootLen);
+        requestFiles();
+    }
+
+    @Override
+    public void close() {
+        // stops provisioning that is in progress
+        closed = true;
+        synchronized (this) {
+            if (released) {
+                return;
+            }
+            released = true;
+            for (long id = takenId; id < readyId; id++) {
+                removeFile(path.trimTo(rootLen).concat(FILE_NAME_PREFIX).put(id).$());
+            }
+            Misc.free(path);
+            Misc.free(provisionPath);
+        }
+    }
+
+    /**
+     * Creates and allocates files up to the given id. Called by worker thread.
+     *
+     * @param hi id of the file to stop at, exclusive
+     */
+    public synchronized void provision(long hi) {
+        try {
+            for (long id = readyId; id < hi && !closed; id++) {
+                provisionPath.trimTo(rootLen).concat(FILE_NAME_PREFIX).put(id).$();
+                final long fd = ff.openRW(provisionPath, CairoConfiguration.O_NONE);
+                if (fd < 0) {
+                    LOG.error().$("could not create pooled file [path=").$(provisionPath).$(", errno=").$(ff.errno()).I$();
+                    return;
+                }
+                try {
+                    if (!ff.allocate(fd, fileSize)) {
+                        LOG.error().$("could not allocate pooled file [path=").$(provisionPath).$(", size=").$(fileSize).$(", errno=").$(ff.errno()).I$();
+                        return;
+                    }
+                } finally {
+                    ff.close(fd);
+                }
+                readyId = id + 1;
+            }
+        } finally {
+            provisioning = false;
+        }
+    }
+
+    /**
+     * Moves next pre-allocated file to the target path. Target file must not exist,
+     * rename would replace it.
+     *
+     * @param target path of column file to be created
+     * @return false when pool has no files ready, in which case caller has to create the file
+     */
+    public boolean take(LPSZ target) {
+        boolean taken = false;
+        if (takenId < readyId) {
+            path.trimTo(rootLen).concat(FILE_NAME_PREFIX).put(takenId++).$();
+            if (ff.rename(path, target)) {
+                taken = true;
+            } else {
+                LOG.error().$("could not take pooled file [from=").$(path).$(", to=").$(target).$(", errno=").$(ff.errno()).I$();
+                removeFile(path);
+            }
+        }
+        requestFiles();
+        return taken;
+    }
+
+    private void removeFile(LPSZ path) {
+        if (!ff.remove(path)) {
+            LOG.error().$("could not remove pooled file [path=").$(path).$(", errno=").$(ff.errno()).I$();
+        }
+    }
+
+    private void removeLeftover(long pUtf8NameZ, int type) {
+        if (type == Files.DT_FILE) {
+            fileNameSink.clear();
+            Chars.utf8DecodeZ(pUtf8NameZ, fileNameSink);
+            if (Chars.startsWith(fileNameSink, FILE_NAME_PREFIX)) {
+                removeFile(path.trimTo(rootLen).concat(pUtf8NameZ).$());
+            }
+        }
+    }
+
+    private void requestFiles() {
+        // top up once half of the pool is used, one request at a time
+        if (!provisioning && readyId - takenId <= capacity / 2) {
+            provisioning = true;
+            final MPSequence seq = messageBus.getColumnFilePoolPubSeq();
+            while (true) {
+                long cursor = seq.next();
+                if (cursor > -1) {
+                    messageBus.getColumnFilePoolQueue().get(cursor).of(this, takenId + capacity);
+                    seq.done(cursor);
+                    return;
+                } else if (cursor == -1) {
+                    // queue is full, try again when next file is taken
+                    provisioning = false;
+                    return;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.cairo;
+
+import io.questdb.MessageBus;
+import io.questdb.mp.AbstractQueueConsumerJob;
+import io.questdb.tasks.ColumnFilePoolTask;
+
+/**
+ * Tops up column file pools of table writers, so that files are created and allocated
+ * by the shared worker pool rather than by the writer when it opens new partition.
+ */
+public class ColumnFilePoolJob extends AbstractQueueConsumerJob<ColumnFilePoolTask> {
+
+    public ColumnFilePoolJob(MessageBus messageBus) {
+        super(messageBus.getColumnFilePoolQueue(), messageBus.getColumnFilePoolSubSeq());
+    }
+
+    @Override
+    protected boolean doRun(int workerId, long cursor) {
+        final ColumnFilePoolTask task = queue.get(cursor);
+        // copy values and release queue item
+        final ColumnFilePool pool = task.getPool();
+        final long hi = task.getHi();
+        task.of(null, 0);
+        subSeq.done(cursor);
+
+        pool.provision(hi);
+        return true;
+    }
+}
@@ -378,16 +378,36 @@ public class DefaultCairoConfiguration implements CairoConfiguration {
         return 100000;
     }
 
+    @Override
+    public long getPartitionChecksumIoBudget() {
+        return 64 * 1024 * 1024;
+    }
+
+    @Override
+    public int getPartitionChecksumQueueCapacity() {
+        return 64;
+    }
+
     @Override
     public int getPartitionPurgeListCapacity() {
         return 64;
     }
 
+    @Override
+    public int getPrefetchQueueCapacity() {
+        return 64;
+    }
+
     @Override
     public int getReaderPoolMaxSegments() {
         return 5;
     }
 
+    @Override
+    public int getReaderPrefetchDistance() {
+        return 0;
+    }
+
     @Override
     public int getRenameTableModelPoolCapacity() {
         return 8;
@@ -699,11 +719,31 @@ public class DefaultCairoConfiguration implements CairoConfiguration {
         return Os.type != Os.WINDOWS ? O_ASYNC : O_NONE;
     }
 
+    @Override
+    public int getWriterFilePoolCapacity() {
+        return 0;
+    }
+
+    @Override
+    public int getWriterFilePoolQueueCapacity() {
+        return 64;
+    }
+
+    @Override
+    public long getWriterMmapReserveSize() {
+        return 0;
+    }
+
     @Override
     public long getWriterCommandQueueSlotSize() {
         return 1024;
     }
 
+    @Override
+    public long getWriterDirectIoBufferSize() {
+        return 1024 * 1024;
+    }
+
     @Override
     public int getWriterTickRowsCountMod() {
         return 1024 - 1;
@@ -719,11 +759,31 @@ public class DefaultCairoConfiguration implements CairoConfiguration {
         return true;
     }
 
+    @Override
+    public boolean isPartitionChecksumEnabled() {
+        return false;
+    }
+
+    @Override
+    public boolean isReaderMadviseEnabled() {
+        return false;
+    }
+
     @Override
     public boolean isSqlJitDebugEnabled() {
         return false;
     }
 
+    @Override
+    public boolean isWriterBatchSyncEnabled() {
+        return false;
+    }
+
+    @Override
+    public boolean isWriterDirectIoEnabled() {
+        return false;
+    }
+
     @Override
     public int getPageFrameReduceRowIdListCapacity() {
         return 32;
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.cairo;
+
+import io.questdb.log.Log;
+import io.questdb.log.LogFactory;
+import io.questdb.std.*;
+
+import java.io.Closeable;
+
+/**
+ * Writes large blocks of column data bypassing page cache, so that bulk partition rewrites
+ * do not evict pages concurrent queries are working with.
+ * <p>
+ * Direct I/O requires file offset, length and buffer address to be aligned. Aligned middle
+ * part of the block is staged in a pool of aligned buffers and written via separate direct
+ * descriptor. Unaligned head and tail go through the regular descriptor: neighbouring blocks
+ * of the same file can be written concurrently, hence partial file blocks must never be
+ * rewritten in full.
+ * <p>
+ * Writer is thread-safe, pool grows up to the number of threads writing concurrently.
+ */
+public class DirectIoWriter implements Closeable {
+    private static final Log LOG = LogFactory.getLog(DirectIoWriter.class);
+    private static final long ALIGNMENT = Files.DIRECT_IO_ALIGNMENT;
+    private final long bufferSize;
+    // aligned addresses of buffers ready for use
+    private final LongList freeBuffers = new LongList();
+    // allocated addresses, these are different from aligned ones
+    private final LongList allocatedBuffers = new LongList();
+    private volatile boolean supported = true;
+
+    public DirectIoWriter(long bufferSize) {
+        this.bufferSize = Math.max(ALIGNMENT, (bufferSize + ALIGNMENT - 1) & -ALIGNMENT);
+    }
+
+    @Override
+    public synchronized void close() {
+        for (int i = 0, n = allocatedBuffers.size(); i < n; i++) {
+            Unsafe.free(allocatedBuffers.getQuick(i), bufferSize + ALIGNMENT, MemoryTag.NATIVE_O3);
+        }
+        allocatedBuffers.clear();
+        freeBuffers.clear();
+    }
+
+    public long getBufferSize() {
+        return bufferSize;
+    }
+
+    /**
+     * @return false when file system rejected direct I/O and writes fall back to page cache
+     */
+    public boolean isSupported() {
+        return supported;
+    }
+
+    /**
+     * Writes memory block to file at given offset. Blocks that are too small to fill
+     * a buffer are written to page cache.
+     *
+     * @param ff      files facade
+     * @param fd      regular file descriptor
+     * @param address address of data
+     * @param len     length of data
+     * @param offset  file offset
+     */
+    public void write(FilesFacade ff, long fd, long address, long len, long offset) {
+        final long lo = (offset + ALIGNMENT - 1) & -ALIGNMENT;
+        final long hi = (offset + len) & -ALIGNMENT;
+        if (!supported || hi - lo < bufferSize) {
+            ff.write(fd, address, len, offset);
+            return;
+        }
+
+        final long directFd = ff.openDirect(fd);
+        if (directFd == -1) {
+            supported = false;
+            LOG.info().$("direct I/O is not supported, using page cache [fd=").$(fd).$(", errno=").$(ff.errno()).I$();
+            ff.write(fd, address, len, offset);
+            return;
+        }
+
+        long p = lo;
+        try {
+            final long buf = acquireBuffer();
+            try {
+                while (p < hi) {
+                    final long n = Math.min(bufferSize, hi - p);
+                    Vect.memcpy(buf, address + p - offset, n);
+                    if (ff.write(directFd, buf, n, p) != n) {
+                        supported = false;
+                        LOG.info().$("direct write failed, using page cache [fd=").$(fd).$(", errno=").$(ff.errno()).I$();
+                        break;
+                    }
+                    p += n;
+                }
+            } finally {
+                releaseBuffer(buf);
+            }
+        } finally {
+            ff.close(directFd);
+        }
+
+        // head, tail and the remainder of failed direct write
+        if (lo > offset) {
+            ff.write(fd, address, lo - offset, offset);
+        }
+        if (offset + len > p) {
+            ff.write(fd, address + p - offset, offset + len - p, p);
+        }
+    }
+
+    private synchronized long acquireBuffer() {
+        final int n = freeBuffers.size();
+        if (n > 0) {
+            final long buf = freeBuffers.getQuick(n - 1);
+            freeBuffers.setPos(n - 1);
+            return buf;
+        }
+        final long mem = Unsafe.malloc(bufferSize + ALIGNMENT, MemoryTag.NATIVE_O3);
+        allocatedBuffers.add(mem);
+        return (mem + ALIGNMENT - 1) & -ALIGNMENT;
+    }
+
+    private synchronized void releaseBuffer(long buf) {
+        freeBuffers.add(buf);
+    }
+}
@@ -25,6 +25,7 @@
 package io.questdb.cairo;
 
 import io.questdb.cairo.sql.DataFrame;
+import io.questdb.std.Files;
 import org.jetbrains.annotations.Nullable;
 
 public class FullBwdDataFrameCursor extends AbstractFullDataFrameCursor {
@@ -37,6 +38,9 @@ public class FullBwdDataFrameCursor extends AbstractFullDataFrameCursor {
                 // this partition is missing, skip
                 partitionIndex--;
             } else {
+                // kernel readahead does not work backwards, ask for the whole partition upfront
+                advisePartition(partitionIndex, Files.POSIX_MADV_WILLNEED);
+                prefetchPartitions(partitionIndex, -1);
                 frame.partitionIndex = partitionIndex;
                 frame.rowHi = hi;
                 partitionIndex--;
@@ -25,6 +25,7 @@
 package io.questdb.cairo;
 
 import io.questdb.cairo.sql.DataFrame;
+import io.questdb.std.Files;
 import org.jetbrains.annotations.Nullable;
 
 public class FullFwdDataFrameCursor extends AbstractFullDataFrameCursor {
@@ -37,6 +38,8 @@ public class FullFwdDataFrameCursor extends AbstractFullDataFrameCursor {
                 // this partition is missing, skip
                 partitionIndex++;
             } else {
+                advisePartition(partitionIndex, Files.POSIX_MADV_SEQUENTIAL);
+                prefetchPartitions(partitionIndex, 1);
                 frame.partitionIndex = partitionIndex;
                 frame.rowLo = 0;
                 frame.rowHi = hi;
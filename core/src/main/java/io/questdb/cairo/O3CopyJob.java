@@ -99,6 +99,7 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
     ) {
         final long opts = tableWriter.getConfiguration().getWriterFileOpenOpts();
         boolean directIoFlag = Os.type != Os.WINDOWS || opts != CairoConfiguration.O_NONE;
+        final DirectIoWriter directIoWriter = tableWriter.getDirectIoWriter();
 
         LOG.debug().$("o3 copy [blockType=").$(blockType)
                 .$(", columnType=").$(columnType)
@@ -159,7 +160,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstVarOffset,
                         dstVarAdjust,
                         dstVarSize,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             case O3_BLOCK_DATA:
@@ -178,7 +180,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstVarOffset,
                         dstVarAdjust,
                         dstVarSize,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             default:
@@ -804,7 +807,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
             long dstVarOffset,
             long dstVarAdjust,
             long dstVarSize,
-            boolean directIoFlag
+            boolean directIoFlag,
+            @Nullable DirectIoWriter directIoWriter
     ) {
         switch (ColumnType.tagOf(columnType)) {
             case ColumnType.STRING:
@@ -823,7 +827,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstVarOffset,
                         dstVarAdjust,
                         dstVarSize,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             default:
@@ -836,7 +841,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstFixFileOffset,
                         dstFixFd,
                         ColumnType.pow2SizeOf(Math.abs(columnType)),
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
         }
@@ -851,12 +857,13 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
             long dstFixFileOffset,
             long dstFd,
             final int shl,
-            boolean directIoFlag
+            boolean directIoFlag,
+            @Nullable DirectIoWriter directIoWriter
     ) {
         final long len = (srcHi - srcLo + 1) << shl;
         final long fromAddress = src + (srcLo << shl);
         if (directIoFlag) {
-            ff.write(Math.abs(dstFd), fromAddress, len, dstFixFileOffset);
+            write(ff, directIoWriter, Math.abs(dstFd), fromAddress, len, dstFixFileOffset);
         } else {
             Vect.memcpy(dstFixAddr, fromAddress, len);
         }
@@ -877,7 +884,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
             long dstVarOffset,
             long dstVarAdjust,
             long dstVarSize,
-            boolean directIoFlag
+            boolean directIoFlag,
+            @Nullable DirectIoWriter directIoWriter
     ) {
         switch (ColumnType.tagOf(columnType)) {
             case ColumnType.STRING:
@@ -899,7 +907,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstVarOffset,
                         dstVarAdjust,
                         dstVarSize,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             case ColumnType.BOOLEAN:
@@ -914,7 +923,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstFixFileOffset,
                         dstFixFd,
                         0,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             case ColumnType.CHAR:
@@ -929,7 +939,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstFixFileOffset,
                         dstFixFd,
                         1,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             case ColumnType.INT:
@@ -945,7 +956,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstFixFileOffset,
                         dstFixFd,
                         2,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             case ColumnType.LONG:
@@ -961,7 +973,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstFixFileOffset,
                         dstFixFd,
                         3,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             case ColumnType.TIMESTAMP:
@@ -978,7 +991,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                             dstFixFileOffset,
                             dstFixFd,
                             3,
-                            directIoFlag
+                            directIoFlag,
+                            directIoWriter
                     );
                 }
                 break;
@@ -992,7 +1006,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                         dstFixFileOffset,
                         dstFixFd,
                         5,
-                        directIoFlag
+                        directIoFlag,
+                        directIoWriter
                 );
                 break;
             default:
@@ -1015,7 +1030,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
             long dstVarOffset,
             long dstVarAdjust,
             long dstVarSize,
-            boolean directIoFlag
+            boolean directIoFlag,
+            @Nullable DirectIoWriter directIoWriter
     ) {
         final long lo = O3Utils.findVarOffset(srcFixAddr, srcLo);
         assert lo >= 0;
@@ -1026,7 +1042,7 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
         assert len <= Math.abs(dstVarSize) - dstVarOffset;
         final long offset = dstVarOffset + dstVarAdjust;
         if (directIoFlag) {
-            ff.write(Math.abs(dstVarFd), srcVarAddr + lo, len, offset);
+            write(ff, directIoWriter, Math.abs(dstVarFd), srcVarAddr + lo, len, offset);
         } else {
             Vect.memcpy(dstVarAddr + dstVarOffset, srcVarAddr + lo, len);
         }
@@ -1040,7 +1056,8 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
                     dstFixFileOffset,
                     dstFixFd,
                     3,
-                    directIoFlag
+                    directIoFlag,
+                    directIoWriter
             );
         } else {
             O3Utils.shiftCopyFixedSizeColumnData(lo - offset, srcFixAddr, srcLo, srcHi + 1, dstFixAddr);
@@ -1143,6 +1160,14 @@ public class O3CopyJob extends AbstractQueueConsumerJob<O3CopyTask> {
         w.setMaxValue(count - 1);
     }
 
+    private static void write(FilesFacade ff, @Nullable DirectIoWriter directIoWriter, long fd, long address, long len, long offset) {
+        if (directIoWriter != null) {
+            directIoWriter.write(ff, fd, address, len, offset);
+        } else {
+            ff.write(fd, address, len, offset);
+        }
+    }
+
     @Override
     protected boolean doRun(int workerId, long cursor) {
         copy(queue.get(cursor), cursor, subSeq);
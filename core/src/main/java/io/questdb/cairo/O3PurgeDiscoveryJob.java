@@ -42,12 +42,14 @@ import java.util.concurrent.atomic.AtomicBoolean;
 public class O3PurgeDiscoveryJob extends AbstractQueueConsumerJob<O3PurgeDiscoveryTask> implements Closeable {
 
     private final static Log LOG = LogFactory.getLog(O3PurgeDiscoveryJob.class);
+    private static final long DIR_SCAN_BUFFER_SIZE = 64 * 1024;
     private final CairoConfiguration configuration;
     private final MutableCharSink[] sink;
     private final StringSink[] fileNameSinks;
     private final ObjList<DirectLongList> partitionList;
     private final ObjList<TxnScoreboard> txnScoreboards;
     private final ObjList<TxReader> txnReaders;
+    private final ObjList<DirScanner> dirScanners;
     private final AtomicBoolean halted = new AtomicBoolean(false);
 
     public O3PurgeDiscoveryJob(MessageBus messageBus, int workerCount) {
@@ -58,6 +60,7 @@ public class O3PurgeDiscoveryJob extends AbstractQueueConsumerJob<O3PurgeDiscove
         this.partitionList = new ObjList<>(workerCount);
         this.txnScoreboards = new ObjList<>(workerCount);
         this.txnReaders = new ObjList<>(workerCount);
+        this.dirScanners = new ObjList<>(workerCount);
 
         for (int i = 0; i < workerCount; i++) {
             sink[i] = new StringSink();
@@ -65,6 +68,7 @@ public class O3PurgeDiscoveryJob extends AbstractQueueConsumerJob<O3PurgeDiscove
             partitionList.add(new DirectLongList(configuration.getPartitionPurgeListCapacity() * 2L, MemoryTag.NATIVE_O3));
             txnScoreboards.add(new TxnScoreboard(configuration.getFilesFacade(), configuration.getTxnScoreboardEntryCount()));
             txnReaders.add(new TxReader(configuration.getFilesFacade()));
+            dirScanners.add(new DirScanner(DIR_SCAN_BUFFER_SIZE));
         }
     }
 
@@ -74,6 +78,7 @@ public class O3PurgeDiscoveryJob extends AbstractQueueConsumerJob<O3PurgeDiscove
             Misc.freeObjList(partitionList);
             Misc.freeObjList(txnReaders);
             Misc.freeObjList(txnScoreboards);
+            Misc.freeObjList(dirScanners);
         }
     }
 
@@ -239,6 +244,7 @@ public class O3PurgeDiscoveryJob extends AbstractQueueConsumerJob<O3PurgeDiscove
             FilesFacade ff,
             MutableCharSink sink,
             StringSink fileNameSink,
+            DirScanner dirScanner,
             DirectLongList partitionList,
             CharSequence root,
             CharSequence tableName,
@@ -254,19 +260,22 @@ public class O3PurgeDiscoveryJob extends AbstractQueueConsumerJob<O3PurgeDiscove
         partitionList.clear();
         DateFormat partitionByFormat = PartitionBy.getPartitionDirFormatMethod(partitionBy);
 
-        long p = ff.findFirst(path);
-        if (p > 0) {
-            try {
-                do {
-                    long fileName = ff.findName(p);
-                    if (Files.isDir(fileName, ff.findType(p), fileNameSink)) {
+        try {
+            if (dirScanner.of(ff, path, 0)) {
+                while (dirScanner.next()) {
+                    if (Files.isDir(dirScanner.getName(), dirScanner.getType(), fileNameSink)) {
                         // extract txn, partition ts from name
                         parsePartitionDateVersion(fileNameSink, partitionList, tableName, partitionByFormat);
                     }
-                } while (ff.findNext(p) > 0);
-            } finally {
-                ff.findClose(p);
+                }
             }
+        } catch (CairoException ex) {
+            // table directory cannot be read, purge is retried with the next commit
+            LOG.error().$("could not scan table directory [table=").$(tableName)
+                    .$(", ex=").$(ex.getFlyweightMessage())
+                    .$(", errno=").$(ex.getErrno())
+                    .I$();
+            return;
         }
 
         // find duplicate partitions
@@ -340,18 +349,22 @@ public class O3PurgeDiscoveryJob extends AbstractQueueConsumerJob<O3PurgeDiscove
     @Override
     protected boolean doRun(int workerId, long cursor) {
         final O3PurgeDiscoveryTask task = queue.get(cursor);
-        discoverPartitions(
-                configuration.getFilesFacade(),
-                sink[workerId],
-                fileNameSinks[workerId],
-                partitionList.get(workerId),
-                configuration.getRoot(),
-                task.getTableName(),
-                txnScoreboards.get(workerId),
-                txnReaders.get(workerId),
-                task.getPartitionBy()
-        );
-        subSeq.done(cursor);
+        try {
+            discoverPartitions(
+                    configuration.getFilesFacade(),
+                    sink[workerId],
+                    fileNameSinks[workerId],
+                    dirScanners.get(workerId),
+                    partitionList.get(workerId),
+                    configuration.getRoot(),
+                    task.getTableName(),
+                    txnScoreboards.get(workerId),
+                    txnReaders.get(workerId),
+                    task.getPartitionBy()
+            );
+        } finally {
+            subSeq.done(cursor);
+        }
         return true;
     }
 
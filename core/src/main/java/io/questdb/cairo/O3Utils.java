@@ -54,6 +54,14 @@ public class O3Utils {
         workerPool.assign(new O3CallbackJob(messageBus));
         workerPool.freeOnHalt(purgeDiscoveryJob);
 
+        if (messageBus.getConfiguration().isPartitionChecksumEnabled()) {
+            final PartitionChecksumJob partitionChecksumJob = new PartitionChecksumJob(messageBus, workerCount);
+            workerPool.assign(partitionChecksumJob);
+            workerPool.freeOnHalt(partitionChecksumJob);
+        }
+        workerPool.assign(new ColumnFilePoolJob(messageBus));
+        workerPool.assign(new PrefetchJob(messageBus));
+
         final MicrosecondClock microsecondClock = messageBus.getConfiguration().getMicrosecondClock();
         final NanosecondClock nanosecondClock = messageBus.getConfiguration().getNanosecondClock();
 
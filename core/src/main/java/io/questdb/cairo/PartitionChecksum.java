@@ -0,0 +1,379 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.cairo;
+
+import io.questdb.cairo.vm.Vm;
+import io.questdb.cairo.vm.api.MemoryCMARW;
+import io.questdb.cairo.vm.api.MemoryCMR;
+import io.questdb.log.Log;
+import io.questdb.log.LogFactory;
+import io.questdb.std.*;
+import io.questdb.std.datetime.microtime.MicrosecondClock;
+import io.questdb.std.str.Path;
+import io.questdb.std.str.StringSink;
+import io.questdb.tasks.PartitionChecksumTask;
+
+import java.io.Closeable;
+
+/**
+ * Computes and verifies checksums of column data files of a partition to detect silent
+ * corruption. Checksums are kept in the partition directory, in a file of entries made
+ * of file name, file size and crc32 of the file content.
+ * <p>
+ * Files are mapped and checksummed in large sequential chunks, one chunk per call to
+ * {@link #resume(boolean)}, so that a worker can interleave scrubbing with other jobs.
+ * Reads are paced to stay within the I/O budget: once the budget is spent, resume() returns
+ * without reading until enough time has passed, it never blocks the calling thread.
+ * Files are checked up to their recorded size, data appended to partition afterwards
+ * does not invalidate the checksum.
+ * <p>
+ * Instances are not thread-safe.
+ */
+public class PartitionChecksum implements Closeable {
+    public static final String CHECKSUM_FILE_NAME = "_cksum";
+    // outcomes of resume()
+    public static final int DONE = 0;
+    public static final int IN_PROGRESS = 1;
+    public static final int THROTTLED = 2;
+    private static final String CHECKSUM_TMP_FILE_NAME = "_cksum.tmp";
+    private static final Log LOG = LogFactory.getLog(PartitionChecksum.class);
+    // multiple of page size and small enough for crc32() to take in one call
+    private static final long CHUNK_SIZE = 16 * 1024 * 1024;
+    private static final long DIR_SCAN_BUFFER_SIZE = 16 * 1024;
+    private final FilesFacade ff;
+    private final MicrosecondClock clock;
+    // bytes per second, 0 for unlimited
+    private final long ioBudget;
+    private final MemoryCMARW writeMem = Vm.getCMARWInstance();
+    private final MemoryCMR readMem = Vm.getCMRInstance();
+    private final Path partitionPath = new Path();
+    private final Path filePath = new Path();
+    private final Path tmpPath = new Path();
+    private final StringSink fileName = new StringSink();
+    private final DirScanner dirScanner = new DirScanner(DIR_SCAN_BUFFER_SIZE);
+    private int mode = -1;
+    private int partitionPathLen;
+    // number of files checksummed by write or number of entries to verify
+    private long entryCount;
+    private long entryIndex;
+    private long entryOffset;
+    private int failedCount;
+    // file that is being read
+    private long fd = -1;
+    private long fileSize;
+    private long fileOffset;
+    private int fileCrc;
+    private int expectedCrc;
+    private long budgetStartUs;
+    private long budgetBytes;
+
+    public PartitionChecksum(CairoConfiguration configuration) {
+        this.ff = configuration.getFilesFacade();
+        this.clock = configuration.getMicrosecondClock();
+        this.ioBudget = configuration.getPartitionChecksumIoBudget();
+    }
+
+    public static boolean isChecksummed(CharSequence fileName) {
+        // column data, index files are rebuilt from data when needed
+        // files of columns that were rewritten carry column name txn after the extension, e.g. "a.d.12"
+        int end = fileName.length();
+        int i = end - 1;
+        while (i > -1 && fileName.charAt(i) >= '0' && fileName.charAt(i) <= '9') {
+            i--;
+        }
+        if (i < end - 1 && i > -1 && fileName.charAt(i) == '.') {
+            end = i;
+        }
+        if (end < 2 || fileName.charAt(end - 2) != '.') {
+            return false;
+        }
+        final char ext = fileName.charAt(end - 1);
+        return ext == 'd' || ext == 'i';
+    }
+
+    /**
+     * Abandons partition that is being processed, if any, and releases its files.
+     */
+    public void clear() {
+        closeFile();
+        writeMem.close(false);
+        readMem.close();
+        dirScanner.clear();
+        mode = -1;
+    }
+
+    @Override
+    public void close() {
+        clear();
+        Misc.free(writeMem);
+        Misc.free(readMem);
+        Misc.free(partitionPath);
+        Misc.free(filePath);
+        Misc.free(tmpPath);
+        Misc.free(dirScanner);
+    }
+
+    public CharSequence getPartitionPath() {
+        return partitionPath;
+    }
+
+    public boolean isIdle() {
+        return mode == -1;
+    }
+
+    /**
+     * Starts processing of the partition, which is then carried out by calls to resume().
+     *
+     * @param partitionPath path to partition directory
+     * @param mode          PartitionChecksumTask.MODE_WRITE to compute and persist checksums,
+     *                      replacing previous ones, or PartitionChecksumTask.MODE_VERIFY to
+     *                      check files against persisted checksums
+     */
+    public void of(CharSequence partitionPath, int mode) {
+        clear();
+        this.partitionPath.of(partitionPath).$();
+        this.partitionPathLen = this.partitionPath.length();
+        this.mode = mode;
+        this.entryCount = 0;
+        this.entryIndex = 0;
+        this.failedCount = 0;
+        resetBudget();
+        if (mode == PartitionChecksumTask.MODE_VERIFY) {
+            openVerify();
+        } else {
+            openWrite();
+        }
+    }
+
+    /**
+     * Reads next chunk of the partition.
+     *
+     * @param throttle true to stay within I/O budget
+     * @return DONE when partition is processed and the instance is idle, IN_PROGRESS when
+     * there is more to read or THROTTLED when I/O budget is spent and nothing was read
+     */
+    public int resume(boolean throttle) {
+        if (mode == -1) {
+            return DONE;
+        }
+        if (fd == -1) {
+            return mode == PartitionChecksumTask.MODE_VERIFY ? nextVerifyFile() : nextWriteFile();
+        }
+        if (throttle && isBudgetSpent()) {
+            return THROTTLED;
+        }
+        checksumChunk();
+        if (fileOffset >= fileSize) {
+            if (mode == PartitionChecksumTask.MODE_VERIFY) {
+                if (fileCrc != expectedCrc) {
+                    LOG.critical().$("checksum mismatch [path=").$(filePath).$(", size=").$(fileSize).$(", crc=").$(expectedCrc).$(", actualCrc=").$(fileCrc).I$();
+                    failedCount++;
+                }
+            } else {
+                writeMem.putStr(fileName);
+                writeMem.putLong(fileSize);
+                writeMem.putInt(fileCrc);
+                entryCount++;
+            }
+            closeFile();
+        }
+        return IN_PROGRESS;
+    }
+
+    /**
+     * Verifies files of the partition against persisted checksums, without pacing reads.
+     *
+     * @param partitionPath path to partition directory
+     * @return number of files that are missing, too short or have content that does not
+     * match the checksum, -1 when partition has no checksums
+     */
+    public int verify(Path partitionPath) {
+        run(partitionPath, PartitionChecksumTask.MODE_VERIFY);
+        return failedCount;
+    }
+
+    /**
+     * Computes checksums of column data files of the partition and persists them
+     * in the partition directory, replacing previous checksums. Reads are not paced.
+     *
+     * @param partitionPath path to partition directory
+     * @return number of checksummed files
+     */
+    public long write(Path partitionPath) {
+        run(partitionPath, PartitionChecksumTask.MODE_WRITE);
+        return entryCount;
+    }
+
+    private void checksumChunk() {
+        final long chunkSize = Math.min(CHUNK_SIZE, fileSize - fileOffset);
+        final long address = TableUtils.mapRO(ff, fd, chunkSize, fileOffset, MemoryTag.MMAP_DEFAULT);
+        try {
+            ff.madvise(address, chunkSize, Files.POSIX_MADV_SEQUENTIAL);
+            fileCrc = Zip.crc32(fileCrc, address, (int) chunkSize);
+        } finally {
+            ff.munmap(address, chunkSize, MemoryTag.MMAP_DEFAULT);
+        }
+        fileOffset += chunkSize;
+        budgetBytes += chunkSize;
+    }
+
+    private void closeFile() {
+        if (fd != -1) {
+            ff.close(fd);
+            fd = -1;
+        }
+    }
+
+    private int finish() {
+        if (mode == PartitionChecksumTask.MODE_VERIFY) {
+            readMem.close();
+            LOG.info().$("verified partition [path=").$(partitionPath).$(", failed=").$(failedCount).I$();
+        } else {
+            writeMem.putLong(0, entryCount);
+            writeMem.close();
+            // checksums are replaced atomically, concurrent verification sees either old or new file
+            filePath.trimTo(partitionPathLen).concat(CHECKSUM_FILE_NAME).$();
+            if (!ff.rename(tmpPath, filePath)) {
+                throw CairoException.instance(ff.errno()).put("could not rename [from=").put(tmpPath).put(", to=").put(filePath).put(']');
+            }
+            LOG.info().$("checksummed partition [path=").$(partitionPath).$(", files=").$(entryCount).I$();
+        }
+        mode = -1;
+        return DONE;
+    }
+
+    private boolean isBudgetSpent() {
+        if (ioBudget > 0) {
+            final long dueUs = budgetBytes * 1_000_000 / ioBudget;
+            return dueUs > clock.getTicks() - budgetStartUs;
+        }
+        return false;
+    }
+
+    private int nextVerifyFile() {
+        if (entryIndex == entryCount) {
+            return finish();
+        }
+        final CharSequence name = readMem.getStr(entryOffset);
+        entryOffset += Vm.getStorageLength(name);
+        fileName.clear();
+        fileName.put(name);
+        fileSize = readMem.getLong(entryOffset);
+        expectedCrc = readMem.getInt(entryOffset + Long.BYTES);
+        entryOffset += Long.BYTES + Integer.BYTES;
+        entryIndex++;
+
+        filePath.trimTo(partitionPathLen).concat(fileName).$();
+        fd = ff.openRO(filePath);
+        if (fd < 0) {
+            fd = -1;
+            filePath.trimTo(partitionPathLen).concat(CHECKSUM_FILE_NAME).$();
+            if (!ff.exists(filePath)) {
+                // partition has been dropped or replaced by newer version since verification started
+                LOG.info().$("partition is gone, verification is abandoned [path=").$(partitionPath).I$();
+                failedCount = 0;
+                readMem.close();
+                mode = -1;
+                return DONE;
+            }
+            filePath.trimTo(partitionPathLen).concat(fileName).$();
+            LOG.critical().$("checksummed file is missing [path=").$(filePath).$(", errno=").$(ff.errno()).I$();
+            failedCount++;
+            return IN_PROGRESS;
+        }
+        final long len = ff.length(fd);
+        if (len < fileSize) {
+            LOG.critical().$("checksummed file is truncated [path=").$(filePath).$(", size=").$(fileSize).$(", actualSize=").$(len).I$();
+            failedCount++;
+            closeFile();
+            return IN_PROGRESS;
+        }
+        fileOffset = 0;
+        fileCrc = 0;
+        return IN_PROGRESS;
+    }
+
+    private int nextWriteFile() {
+        while (dirScanner.next()) {
+            if (dirScanner.getType() != Files.DT_FILE) {
+                continue;
+            }
+            fileName.clear();
+            Chars.utf8DecodeZ(dirScanner.getName(), fileName);
+            if (!isChecksummed(fileName)) {
+                continue;
+            }
+            filePath.trimTo(partitionPathLen).concat(fileName).$();
+            final long size = dirScanner.getSize();
+            fd = TableUtils.openRO(ff, filePath, LOG);
+            fileSize = size < 0 ? ff.length(fd) : size;
+            fileOffset = 0;
+            fileCrc = 0;
+            return IN_PROGRESS;
+        }
+        return finish();
+    }
+
+    private void openVerify() {
+        filePath.trimTo(partitionPathLen).concat(CHECKSUM_FILE_NAME).$();
+        if (!ff.exists(filePath)) {
+            failedCount = -1;
+            mode = -1;
+            return;
+        }
+        readMem.smallFile(ff, filePath, MemoryTag.MMAP_DEFAULT);
+        entryCount = readMem.getLong(0);
+        entryOffset = Long.BYTES;
+    }
+
+    private void openWrite() {
+        if (!dirScanner.of(ff, filePath.of(partitionPath).$(), Files.SCAN_DIR_STAT)) {
+            // partition directory is gone, writer dropped it
+            mode = -1;
+            return;
+        }
+        tmpPath.of(partitionPath).concat(CHECKSUM_TMP_FILE_NAME).$();
+        writeMem.smallFile(ff, tmpPath, MemoryTag.MMAP_DEFAULT);
+        writeMem.jumpTo(0);
+        writeMem.putLong(0);
+    }
+
+    private void resetBudget() {
+        budgetStartUs = clock.getTicks();
+        budgetBytes = 0;
+    }
+
+    private void run(Path partitionPath, int mode) {
+        try {
+            of(partitionPath, mode);
+            while (resume(false) != DONE) {
+                // keep reading
+            }
+        } catch (Throwable e) {
+            clear();
+            throw e;
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.cairo;
+
+import io.questdb.MessageBus;
+import io.questdb.log.Log;
+import io.questdb.log.LogFactory;
+import io.questdb.mp.Job;
+import io.questdb.mp.RingQueue;
+import io.questdb.mp.Sequence;
+import io.questdb.std.Misc;
+import io.questdb.std.ObjList;
+import io.questdb.tasks.PartitionChecksumTask;
+
+import java.io.Closeable;
+
+/**
+ * Computes and verifies partition checksums in the background. Each worker takes a
+ * partition off the queue and reads it one chunk per invocation, so that the job shares
+ * worker with queries and commits. When I/O budget is spent the job returns straight away
+ * and the worker carries on with other jobs. Scrubbing throughput scales with the number
+ * of workers.
+ */
+public class PartitionChecksumJob implements Job, Closeable {
+    private static final Log LOG = LogFactory.getLog(PartitionChecksumJob.class);
+    private final RingQueue<PartitionChecksumTask> queue;
+    private final Sequence subSeq;
+    private final ObjList<PartitionChecksum> checksums;
+
+    public PartitionChecksumJob(MessageBus messageBus, int workerCount) {
+        this.queue = messageBus.getPartitionChecksumQueue();
+        this.subSeq = messageBus.getPartitionChecksumSubSeq();
+        final CairoConfiguration configuration = messageBus.getConfiguration();
+        this.checksums = new ObjList<>(workerCount);
+        for (int i = 0; i < workerCount; i++) {
+            checksums.add(new PartitionChecksum(configuration));
+        }
+    }
+
+    @Override
+    public void close() {
+        Misc.freeObjList(checksums);
+    }
+
+    @Override
+    public boolean run(int workerId) {
+        final PartitionChecksum checksum = checksums.getQuick(workerId);
+        try {
+            if (checksum.isIdle()) {
+                final long cursor = subSeq.next();
+                if (cursor < 0) {
+                    return false;
+                }
+                final PartitionChecksumTask task = queue.get(cursor);
+                try {
+                    // values are copied, queue item is released straight away
+                    checksum.of(task.getPartitionPath(), task.getMode());
+                } finally {
+                    subSeq.done(cursor);
+                }
+            }
+            return checksum.resume(true) != PartitionChecksum.THROTTLED;
+        } catch (CairoException e) {
+            LOG.error().$("could not checksum partition [path=").$(checksum.getPartitionPath()).$(", errno=").$(e.getErrno()).$(", msg=").$(e.getFlyweightMessage()).I$();
+            checksum.clear();
+            return true;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.cairo;
+
+import io.questdb.MessageBus;
+import io.questdb.mp.AbstractQueueConsumerJob;
+import io.questdb.std.Files;
+import io.questdb.std.FilesFacade;
+import io.questdb.tasks.PrefetchTask;
+
+/**
+ * Reads ahead mapped column files on behalf of query threads. The mapping might be
+ * gone by the time the task is picked up, which is harmless: madvise() on
+ * an unmapped range fails without side effects.
+ */
+public class PrefetchJob extends AbstractQueueConsumerJob<PrefetchTask> {
+
+    public PrefetchJob(MessageBus messageBus) {
+        super(messageBus.getPrefetchQueue(), messageBus.getPrefetchSubSeq());
+    }
+
+    @Override
+    protected boolean doRun(int workerId, long cursor) {
+        final PrefetchTask task = queue.get(cursor);
+        // copy values and release queue item
+        final FilesFacade ff = task.ff;
+        final long address = task.address;
+        final long len = task.len;
+        task.ff = null;
+        subSeq.done(cursor);
+
+        ff.madvise(address, len, Files.POSIX_MADV_WILLNEED);
+        return true;
+    }
+}
@@ -89,6 +89,7 @@ public class SymbolMapWriter implements Closeable, MapWriter {
                     ff,
                     path,
                     mapPageSize,
+                    configuration.getWriterMmapReserveSize(),
                     MemoryTag.MMAP_INDEX_WRITER,
                     configuration.getWriterFileOpenOpts()
             );
@@ -114,6 +115,7 @@ public class SymbolMapWriter implements Closeable, MapWriter {
                     ff,
                     charFileName(path.trimTo(plen), name, columnNameTxn),
                     mapPageSize,
+                    configuration.getWriterMmapReserveSize(),
                     MemoryTag.MMAP_INDEX_WRITER,
                     configuration.getWriterFileOpenOpts()
             );
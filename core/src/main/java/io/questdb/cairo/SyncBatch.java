@@ -0,0 +1,274 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.cairo;
+
+import io.questdb.log.Log;
+import io.questdb.log.LogFactory;
+import io.questdb.std.FilesFacade;
+import io.questdb.std.IOURing;
+import io.questdb.std.LongList;
+import io.questdb.std.Misc;
+import org.jetbrains.annotations.Nullable;
+
+import java.io.Closeable;
+
+/**
+ * Makes a set of file ranges durable with a handful of system calls instead of one msync()
+ * per mapped column. Ranges of the same file are coalesced, each file gets a chain of
+ * sync_file_range() operations linked to a final fdatasync() and chains of all files are
+ * submitted to io_uring together, so that the kernel flushes files in parallel. When the ring
+ * itself fails, files of the batch are flushed with plain fsync() instead. When the ring
+ * cannot be created, e.g. because of RLIMIT_MEMLOCK, memory shortage or seccomp policy,
+ * the batch keeps flushing files with fsync().
+ * <p>
+ * Batch is not thread-safe and requires io_uring, see {@link IOURing#isAvailable()}.
+ */
+public class SyncBatch implements Closeable {
+    private static final Log LOG = LogFactory.getLog(SyncBatch.class);
+    private static final int RANGE_SIZE = 3;
+    private static volatile boolean ringFailureLogged = false;
+    // fd, lo and hi of each range
+    private final LongList ranges = new LongList();
+    private final FilesFacade ff;
+    private final RingFactory ringFactory;
+    // null when ring could not be re-created after failure
+    private IOURing ring;
+    private int inFlight;
+    private boolean failed;
+    // submission failed, state of the operations queued to the ring is unknown
+    private boolean ringFailed;
+
+    public SyncBatch(FilesFacade ff, int capacity) {
+        this(ff, IOURing::new, capacity);
+    }
+
+    SyncBatch(FilesFacade ff, RingFactory ringFactory, int capacity) {
+        this.ff = ff;
+        this.ringFactory = ringFactory;
+        this.ring = ringFactory.newInstance(capacity);
+    }
+
+    /**
+     * @return new batch or null when io_uring cannot be set up, in which case caller is
+     * expected to flush files one by one
+     */
+    @Nullable
+    public static SyncBatch newInstance(FilesFacade ff, int capacity) {
+        return newInstance(ff, IOURing::new, capacity);
+    }
+
+    @Nullable
+    static SyncBatch newInstance(FilesFacade ff, RingFactory ringFactory, int capacity) {
+        try {
+            return new SyncBatch(ff, ringFactory, capacity);
+        } catch (CairoException e) {
+            logRingFailure(e);
+            return null;
+        }
+    }
+
+    public void add(long fd, long offset, long len) {
+        if (len > 0) {
+            ranges.add(fd);
+            ranges.add(offset);
+            ranges.add(offset + len);
+        }
+    }
+
+    public void clear() {
+        ranges.clear();
+    }
+
+    @Override
+    public void close() {
+        Misc.free(ring);
+    }
+
+    /**
+     * Sorts ranges and merges those that overlap or touch.
+     *
+     * @return number of ranges left
+     */
+    int coalesce() {
+        sortRanges();
+        int n = 0;
+        for (int i = 0, size = ranges.size(); i < size; i += RANGE_SIZE) {
+            final long fd = ranges.getQuick(i);
+            final long lo = ranges.getQuick(i + 1);
+            final long hi = ranges.getQuick(i + 2);
+            if (n > 0) {
+                final int last = (n - 1) * RANGE_SIZE;
+                if (ranges.getQuick(last) == fd && ranges.getQuick(last + 2) >= lo) {
+                    ranges.setQuick(last + 2, Math.max(hi, ranges.getQuick(last + 2)));
+                    continue;
+                }
+            }
+            final int p = n++ * RANGE_SIZE;
+            ranges.setQuick(p, fd);
+            ranges.setQuick(p + 1, lo);
+            ranges.setQuick(p + 2, hi);
+        }
+        ranges.setPos(n * RANGE_SIZE);
+        return n;
+    }
+
+    /**
+     * Flushes added ranges to disk and clears the batch.
+     *
+     * @return false when any of the operations failed, caller is expected to fall back to
+     * regular synchronous flush to find out what is wrong
+     */
+    public boolean sync() {
+        final int rangeCount = coalesce();
+        if (ring == null) {
+            final boolean ok = fsyncAll(rangeCount);
+            ranges.clear();
+            return ok;
+        }
+        final int capacity = ring.getCapacity();
+        failed = false;
+        ringFailed = false;
+        inFlight = 0;
+
+        int i = 0;
+        while (i < rangeCount && !ringFailed) {
+            final long fd = ranges.getQuick(i * RANGE_SIZE);
+            int j = i + 1;
+            while (j < rangeCount && ranges.getQuick(j * RANGE_SIZE) == fd) {
+                j++;
+            }
+
+            // chain has to fit submission queue, fdatasync() alone flushes the whole file anyway
+            final boolean ranged = j - i < capacity;
+            final int chainLen = ranged ? j - i + 1 : 1;
+            if (inFlight + chainLen > capacity) {
+                drain();
+                if (ringFailed) {
+                    break;
+                }
+            }
+            if (ranged) {
+                for (int k = i; k < j; k++) {
+                    final long lo = ranges.getQuick(k * RANGE_SIZE + 1);
+                    final long len = ranges.getQuick(k * RANGE_SIZE + 2) - lo;
+                    // length of zero means to the end of file, sqe cannot carry more than 32 bits
+                    ring.enqueueSyncFileRange(fd, lo, len > Integer.MAX_VALUE ? 0 : len, IOURing.FLAG_LINK);
+                }
+            }
+            ring.enqueueFdatasync(fd);
+            inFlight += chainLen;
+            i = j;
+        }
+        drain();
+        if (ringFailed) {
+            // some of the chains may have never been submitted, flush every file of the batch
+            resetRing();
+            failed = !fsyncAll(rangeCount);
+        }
+        ranges.clear();
+        return !failed;
+    }
+
+    private void drain() {
+        if (inFlight > 0) {
+            if (ring.submitAndWait(inFlight) < 0) {
+                ringFailed = true;
+            }
+            while (inFlight > 0 && !ringFailed) {
+                while (ring.nextCqe()) {
+                    if (ring.getCqeRes() < 0) {
+                        failed = true;
+                    }
+                    inFlight--;
+                }
+                if (inFlight > 0 && ring.submitAndWait(inFlight) < 0) {
+                    ringFailed = true;
+                }
+            }
+            if (ringFailed) {
+                inFlight = 0;
+            }
+        }
+    }
+
+    private boolean fsyncAll(int rangeCount) {
+        boolean ok = true;
+        long lastFd = -1;
+        // ranges are sorted by fd
+        for (int i = 0; i < rangeCount; i++) {
+            final long fd = ranges.getQuick(i * RANGE_SIZE);
+            if (fd != lastFd) {
+                ok &= ff.fsync(fd) == 0;
+                lastFd = fd;
+            }
+        }
+        return ok;
+    }
+
+    private static void logRingFailure(CairoException e) {
+        // failure is likely to be persistent, do not flood the log with it
+        if (!ringFailureLogged) {
+            ringFailureLogged = true;
+            LOG.advisory().$("io_uring is not available, files are synced one by one [errno=").$(e.getErrno()).$(", msg=").$(e.getFlyweightMessage()).I$();
+        }
+    }
+
+    private void resetRing() {
+        // operations left in the ring are dropped with it, completions of the old ring
+        // cannot be mistaken for completions of the next batch
+        final int capacity = ring.getCapacity();
+        ring = Misc.free(ring);
+        try {
+            ring = ringFactory.newInstance(capacity);
+        } catch (CairoException e) {
+            logRingFailure(e);
+        }
+    }
+
+    private void sortRanges() {
+        // insertion sort, ranges are added in file order most of the time
+        for (int i = RANGE_SIZE, n = ranges.size(); i < n; i += RANGE_SIZE) {
+            final long fd = ranges.getQuick(i);
+            final long lo = ranges.getQuick(i + 1);
+            final long hi = ranges.getQuick(i + 2);
+            int j = i - RANGE_SIZE;
+            while (j >= 0 && (ranges.getQuick(j) > fd || (ranges.getQuick(j) == fd && ranges.getQuick(j + 1) > lo))) {
+                ranges.setQuick(j + RANGE_SIZE, ranges.getQuick(j));
+                ranges.setQuick(j + RANGE_SIZE + 1, ranges.getQuick(j + 1));
+                ranges.setQuick(j + RANGE_SIZE + 2, ranges.getQuick(j + 2));
+                j -= RANGE_SIZE;
+            }
+            ranges.setQuick(j + RANGE_SIZE, fd);
+            ranges.setQuick(j + RANGE_SIZE + 1, lo);
+            ranges.setQuick(j + RANGE_SIZE + 2, hi);
+        }
+    }
+
+    @FunctionalInterface
+    interface RingFactory {
+        IOURing newInstance(int capacity);
+    }
+}
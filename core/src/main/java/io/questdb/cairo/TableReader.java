@@ -33,10 +33,13 @@ import io.questdb.cairo.vm.api.MemoryMR;
 import io.questdb.cairo.vm.api.MemoryR;
 import io.questdb.log.Log;
 import io.questdb.log.LogFactory;
+import io.questdb.mp.MPSequence;
+import io.questdb.mp.RingQueue;
 import io.questdb.std.*;
 import io.questdb.std.datetime.DateFormat;
 import io.questdb.std.str.CharSink;
 import io.questdb.std.str.Path;
+import io.questdb.tasks.PrefetchTask;
 import org.jetbrains.annotations.NotNull;
 import org.jetbrains.annotations.Nullable;
 
@@ -66,6 +69,8 @@ public class TableReader implements Closeable, SymbolTableSource {
     private final MemoryMR todoMem = Vm.getMRInstance();
     private final TxnScoreboard txnScoreboard;
     private final ColumnVersionReader columnVersionReader;
+    private final boolean madviseEnabled;
+    private final int prefetchDistance;
     private int partitionCount;
     private LongList columnTops;
     private ObjList<MemoryMR> columns;
@@ -86,6 +91,9 @@ public class TableReader implements Closeable, SymbolTableSource {
         this.ff = configuration.getFilesFacade();
         this.tableName = Chars.toString(tableName);
         this.messageBus = messageBus;
+        this.madviseEnabled = configuration.isReaderMadviseEnabled();
+        // read-ahead is served by worker pool via message bus
+        this.prefetchDistance = messageBus != null ? configuration.getReaderPrefetchDistance() : 0;
         this.path = new Path();
         this.path.of(configuration.getRoot()).concat(this.tableName);
         this.rootLen = path.length();
@@ -138,6 +146,24 @@ public class TableReader implements Closeable, SymbolTableSource {
         return 2 + base + index * 2;
     }
 
+    /**
+     * Advises OS on how column files of open partition are going to be accessed. The call
+     * is a no-op when partition is not open or when madvise is disabled in configuration.
+     *
+     * @param partitionIndex index of the partition
+     * @param advice         one of Files.POSIX_MADV_* or Files.MADV_* constants
+     */
+    public void advisePartition(int partitionIndex, int advice) {
+        if (madviseEnabled && partitionIndex < partitionCount && openPartitionInfo.getQuick(partitionIndex * PARTITIONS_SLOT_SIZE + PARTITIONS_SLOT_OFFSET_SIZE) > 0) {
+            final int base = getColumnBase(partitionIndex);
+            for (int i = 0; i < columnCount; i++) {
+                final int index = getPrimaryColumnIndex(base, i);
+                adviseColumn(columns.getQuick(index), advice);
+                adviseColumn(columns.getQuick(index + 1), advice);
+            }
+        }
+    }
+
     @Override
     public void close() {
         if (isOpen()) {
@@ -279,6 +305,10 @@ public class TableReader implements Closeable, SymbolTableSource {
         return metadata.getPartitionBy();
     }
 
+    public int getPrefetchDistance() {
+        return prefetchDistance;
+    }
+
     public SymbolMapReader getSymbolMapReader(int columnIndex) {
         return symbolMapReaders.getQuick(columnIndex);
     }
@@ -328,6 +358,27 @@ public class TableReader implements Closeable, SymbolTableSource {
         return openPartition0(partitionIndex);
     }
 
+    /**
+     * Opens partition and queues read-ahead of its column files for the worker pool. When prefetch
+     * queue is full, e.g. because no worker consumes it, read-ahead of the remaining columns is
+     * requested from the calling thread instead.
+     *
+     * @param partitionIndex index of partition that scan is going to reach later
+     */
+    public void prefetchPartition(int partitionIndex) {
+        if (prefetchDistance > 0 && openPartition(partitionIndex) > 0) {
+            final MPSequence pubSeq = messageBus.getPrefetchPubSeq();
+            final RingQueue<PrefetchTask> queue = messageBus.getPrefetchQueue();
+            final int base = getColumnBase(partitionIndex);
+            boolean queued = true;
+            for (int i = 0; i < columnCount; i++) {
+                final int index = getPrimaryColumnIndex(base, i);
+                queued = prefetchColumn(columns.getQuick(index), pubSeq, queue, queued);
+                queued = prefetchColumn(columns.getQuick(index + 1), pubSeq, queue, queued);
+            }
+        }
+    }
+
     public void reconcileOpenPartitionsFrom(int partitionIndex, boolean forceTruncate) {
         int txPartitionCount = txFile.getPartitionCount();
         int txPartitionIndex = partitionIndex;
@@ -476,6 +527,38 @@ public class TableReader implements Closeable, SymbolTableSource {
         return rowCount;
     }
 
+    private static void adviseColumn(MemoryMR mem, int advice) {
+        if (mem != null) {
+            mem.advise(advice);
+        }
+    }
+
+    private boolean prefetchColumn(MemoryMR mem, MPSequence pubSeq, RingQueue<PrefetchTask> queue, boolean queued) {
+        if (mem == null) {
+            return queued;
+        }
+        final long address = mem.getPageAddress(0);
+        final long size = mem.size();
+        if (address == 0 || size == 0) {
+            return queued;
+        }
+        while (queued) {
+            final long cursor = pubSeq.next();
+            if (cursor > -1) {
+                queue.get(cursor).of(ff, address, size);
+                pubSeq.done(cursor);
+                return true;
+            }
+            if (cursor == -1) {
+                // queue is full, do not try queueing remaining columns
+                queued = false;
+            }
+        }
+        // WILLNEED only starts asynchronous read-ahead, it does not wait for the pages
+        ff.madvise(address, size, Files.POSIX_MADV_WILLNEED);
+        return false;
+    }
+
     private static int getColumnBits(int columnCount) {
         return Numbers.msb(Numbers.ceilPow2(columnCount) * 2);
     }
@@ -38,6 +38,7 @@ import io.questdb.std.str.CharSink;
 import io.questdb.std.str.LPSZ;
 import io.questdb.std.str.Path;
 import io.questdb.tasks.O3PurgeDiscoveryTask;
+import io.questdb.tasks.PartitionChecksumTask;
 import org.jetbrains.annotations.Nullable;
 
 import static io.questdb.cairo.MapWriter.createSymbolMapFiles;
@@ -688,6 +689,21 @@ public final class TableUtils {
         }
     }
 
+    public static boolean schedulePartitionChecksum(MessageBus messageBus, CharSequence partitionPath, int mode) {
+        final MPSequence seq = messageBus.getPartitionChecksumPubSeq();
+        while (true) {
+            long cursor = seq.next();
+            if (cursor > -1) {
+                PartitionChecksumTask task = messageBus.getPartitionChecksumQueue().get(cursor);
+                task.of(partitionPath, mode);
+                seq.done(cursor);
+                return true;
+            } else if (cursor == -1) {
+                return false;
+            }
+        }
+    }
+
     /**
      * Sets the path to the directory of a partition taking into account the timestamp and the partitioning scheme.
      *
@@ -70,6 +70,7 @@ public class TableWriter implements Closeable {
     private static final int ROW_ACTION_NO_TIMESTAMP = 2;
     private static final int ROW_ACTION_O3 = 3;
     private static final int ROW_ACTION_SWITCH_PARTITION = 4;
+    private static final int SYNC_BATCH_CAPACITY = 256;
     private static final Log LOG = LogFactory.getLog(TableWriter.class);
     private static final CharSequenceHashSet IGNORED_FILES = new CharSequenceHashSet();
     private static final Runnable NOOP = () -> {
@@ -136,7 +137,15 @@ public class TableWriter implements Closeable {
     private final MPSequence o3PartitionUpdatePubSeq;
     private final SCSequence o3PartitionUpdateSubSeq;
     private final boolean o3QuickSortEnabled;
+    private final DirectIoWriter directIoWriter;
+    private final SyncBatch syncBatch;
+    private final ColumnFilePool columnFilePool;
+    private final boolean partitionChecksumEnabled;
+    // partitions changed by current transaction, checksummed once it is committed
+    private final LongList checksumPartitionTimestamps = new LongList();
     private final LongConsumer appendTimestampSetter;
+    // active partition is checksummed when writer moves on from it, either by switching or via O3
+    private long checksumActivePartitionTimestamp;
     private final MemoryMR indexMem = Vm.getMRInstance();
     private final MemoryFR slaveMetaMem = new MemoryFCRImpl();
     private final LongIntHashMap replPartitionHash = new LongIntHashMap();
@@ -235,6 +244,10 @@ public class TableWriter implements Closeable {
         this.fileOperationRetryCount = configuration.getFileOperationRetryCount();
         this.tableName = Chars.toString(tableName);
         this.o3QuickSortEnabled = configuration.isO3QuickSortEnabled();
+        // buffers are allocated on first large O3 write
+        this.directIoWriter = configuration.isWriterDirectIoEnabled() ? new DirectIoWriter(configuration.getWriterDirectIoBufferSize()) : null;
+        this.syncBatch = configuration.isWriterBatchSyncEnabled() && IOURing.isAvailable() ? SyncBatch.newInstance(ff, SYNC_BATCH_CAPACITY) : null;
+        this.partitionChecksumEnabled = configuration.isPartitionChecksumEnabled();
         this.o3PartitionUpdateQueue = new RingQueue<>(O3PartitionUpdateTask.CONSTRUCTOR, configuration.getO3PartitionUpdateQueueCapacity());
         this.o3PartitionUpdatePubSeq = new MPSequence(this.o3PartitionUpdateQueue.getCycle());
         this.o3PartitionUpdateSubSeq = new SCSequence();
@@ -307,6 +320,11 @@ public class TableWriter implements Closeable {
                 partitionDirFmt = null;
             }
             this.commitInterval = calculateCommitInterval();
+            if (PartitionBy.isPartitioned(partitionBy) && configuration.getWriterFilePoolCapacity() > 0) {
+                this.columnFilePool = new ColumnFilePool(configuration, this.messageBus, path.trimTo(rootLen));
+            } else {
+                this.columnFilePool = null;
+            }
 
             configureColumnMemory();
             configureTimestampSetter();
@@ -314,6 +332,10 @@ public class TableWriter implements Closeable {
             configureAppendPosition();
             purgeUnusedPartitions();
             clearTodoLog();
+            if (partitionChecksumEnabled) {
+                this.checksumActivePartitionTimestamp = txWriter.getLastPartitionTimestamp();
+                schedulePartitionVerification();
+            }
             this.slaveTxReader = new TxReader(ff);
             commandQueue = new RingQueue<>(
                     TableWriterTask::new,
@@ -727,6 +749,11 @@ public class TableWriter implements Closeable {
         return designatedTimestampColumnName;
     }
 
+    @Nullable
+    public DirectIoWriter getDirectIoWriter() {
+        return directIoWriter;
+    }
+
     public FilesFacade getFilesFacade() {
         return ff;
     }
@@ -1233,6 +1260,7 @@ public class TableWriter implements Closeable {
                 }
                 freeColumns(false);
                 this.txWriter.unsafeLoadAll();
+                checksumPartitionTimestamps.clear();
                 rollbackIndexes();
                 rollbackSymbolTables();
                 purgeUnusedPartitions();
@@ -1923,6 +1951,7 @@ public class TableWriter implements Closeable {
             if (hasO3() && o3Commit(commitLag)) {
                 // Bookmark masterRef to track how many rows is in uncommitted state
                 this.committedMasterRef = masterRef;
+                schedulePartitionChecksums();
                 return;
             }
 
@@ -1941,6 +1970,7 @@ public class TableWriter implements Closeable {
             // Bookmark masterRef to track how many rows is in uncommitted state
             this.committedMasterRef = masterRef;
             o3ProcessPartitionRemoveCandidates();
+            schedulePartitionChecksums();
 
             metrics.tableWriter().incrementCommits();
             metrics.tableWriter().addCommittedRows(rowsAdded);
@@ -2210,6 +2240,8 @@ public class TableWriter implements Closeable {
         Misc.free(o3ColumnTopSink);
         Misc.free(commandQueue);
         freeColumns(truncate & !distressed);
+        // pooled files are removed while table is still locked
+        Misc.free(columnFilePool);
         try {
             releaseLock(!truncate | tx | performRecovery | distressed);
         } finally {
@@ -2217,6 +2249,8 @@ public class TableWriter implements Closeable {
             Misc.free(path);
             Misc.free(o3TimestampMemCpy);
             Misc.free(ownMessageBus);
+            Misc.free(directIoWriter);
+            Misc.free(syncBatch);
             freeTempMem();
             LOG.info().$("closed '").utf8(tableName).$('\'').$();
         }
@@ -3371,6 +3405,10 @@ public class TableWriter implements Closeable {
                 .$(", partitionSize=").$(partitionSize)
                 .I$();
 
+        if (partitionChecksumEnabled && checksumPartitionTimestamps.indexOf(partitionTimestamp) < 0) {
+            checksumPartitionTimestamps.add(partitionTimestamp);
+        }
+
         if (partitionMutates) {
             final long srcDataTxn = txWriter.getPartitionNameTxnByIndex(partitionIndex);
             LOG.info()
@@ -3760,22 +3798,30 @@ public class TableWriter implements Closeable {
         o3TimestampMem.putLong128(timestamp, getO3RowCount0());
     }
 
-    private void openColumnFiles(CharSequence name, long columnNameTxn, int columnIndex, int pathTrimToLen) {
+    private void openColumnFiles(CharSequence name, long columnNameTxn, int columnIndex, int pathTrimToLen, boolean pooled) {
         MemoryMA mem1 = getPrimaryColumn(columnIndex);
         MemoryMA mem2 = getSecondaryColumn(columnIndex);
 
         try {
-            mem1.of(ff, dFile(
-                    path.trimTo(pathTrimToLen), name, columnNameTxn),
+            dFile(path.trimTo(pathTrimToLen), name, columnNameTxn);
+            if (pooled) {
+                takePooledFile(path);
+            }
+            mem1.of(ff,
+                    path,
                     configuration.getDataAppendPageSize(),
                     -1,
                     MemoryTag.MMAP_TABLE_WRITER,
                     configuration.getWriterFileOpenOpts()
             );
             if (mem2 != null) {
+                iFile(path.trimTo(pathTrimToLen), name, columnNameTxn);
+                if (pooled) {
+                    takePooledFile(path);
+                }
                 mem2.of(
                         ff,
-                        iFile(path.trimTo(pathTrimToLen), name, columnNameTxn),
+                        path,
                         configuration.getDataAppendPageSize(),
                         -1,
                         MemoryTag.MMAP_TABLE_WRITER,
@@ -3815,7 +3861,7 @@ public class TableWriter implements Closeable {
                 createIndexFiles(name, columnNameTxn, indexValueBlockCapacity, plen, true);
             }
 
-            openColumnFiles(name, columnNameTxn, columnIndex, plen);
+            openColumnFiles(name, columnNameTxn, columnIndex, plen, false);
             if (txWriter.getTransientRowCount() > 0) {
                 // write top offset to column version file
                 columnVersionWriter.upsert(txWriter.getLastPartitionTimestamp(), columnIndex, columnNameTxn, txWriter.getTransientRowCount());
@@ -3849,6 +3895,8 @@ public class TableWriter implements Closeable {
             assert columnCount > 0;
 
             long partitionTimestamp = txWriter.getPartitionTimestampLo(timestamp);
+            // files of new partition can be taken from the pool
+            final boolean pooled = columnFilePool != null && txWriter.getTransientRowCount() < 1;
             for (int i = 0; i < columnCount; i++) {
                 if (metadata.getColumnType(i) > 0) {
                     final CharSequence name = metadata.getColumnName(i);
@@ -3864,7 +3912,7 @@ public class TableWriter implements Closeable {
                         indexer.closeSlider();
                     }
 
-                    openColumnFiles(name, columnNameTxn, i, plen);
+                    openColumnFiles(name, columnNameTxn, i, plen, pooled);
                     columnTop = columnVersionWriter.getColumnTop(partitionTimestamp, i);
                     columnTops.extendAndSet(i, columnTop);
 
@@ -4779,6 +4827,50 @@ public class TableWriter implements Closeable {
         }
     }
 
+    private void schedulePartitionChecksums() {
+        if (!partitionChecksumEnabled) {
+            return;
+        }
+        final long activePartitionTimestamp = txWriter.getLastPartitionTimestamp();
+        if (checksumActivePartitionTimestamp != activePartitionTimestamp) {
+            if (checksumPartitionTimestamps.indexOf(checksumActivePartitionTimestamp) < 0) {
+                checksumPartitionTimestamps.add(checksumActivePartitionTimestamp);
+            }
+            checksumActivePartitionTimestamp = activePartitionTimestamp;
+        }
+        for (int i = 0, n = checksumPartitionTimestamps.size(); i < n; i++) {
+            final long timestamp = checksumPartitionTimestamps.getQuick(i);
+            // active partition is still appended to, it is checksummed when writer moves on from it;
+            // partition could also have been dropped or was never created by this transaction
+            if (timestamp == activePartitionTimestamp || txWriter.findAttachedPartitionIndexByLoTimestamp(timestamp) < 0) {
+                continue;
+            }
+            setPathForPartition(other, partitionBy, timestamp, false);
+            TableUtils.txnPartitionConditionally(other, txWriter.getPartitionNameTxnByPartitionTimestamp(timestamp));
+            if (!TableUtils.schedulePartitionChecksum(messageBus, other, PartitionChecksumTask.MODE_WRITE)) {
+                LOG.error().$("checksum queue is full, partition is left without checksum [path=").$(other).I$();
+            }
+            other.trimTo(rootLen);
+        }
+        checksumPartitionTimestamps.clear();
+    }
+
+    private void schedulePartitionVerification() {
+        // active partition is not checksummed yet, skip it
+        for (int i = 0, n = txWriter.getPartitionCount() - 1; i < n; i++) {
+            setPathForPartition(other, partitionBy, txWriter.getPartitionTimestamp(i), false);
+            TableUtils.txnPartitionConditionally(other, txWriter.getPartitionNameTxn(i));
+            final int partitionLen = other.length();
+            if (ff.exists(other.concat(PartitionChecksum.CHECKSUM_FILE_NAME).$())
+                    && !TableUtils.schedulePartitionChecksum(messageBus, other.trimTo(partitionLen), PartitionChecksumTask.MODE_VERIFY)) {
+                LOG.info().$("checksum queue is full, remaining partitions are verified on next open [table=`").utf8(tableName).$('`').I$();
+                other.trimTo(rootLen);
+                break;
+            }
+            other.trimTo(rootLen);
+        }
+    }
+
     private void setColumnSize(int columnIndex, long size, boolean doubleAllocate) {
         MemoryMA mem1 = getPrimaryColumn(columnIndex);
         MemoryMA mem2 = getSecondaryColumn(columnIndex);
@@ -4868,8 +4960,17 @@ public class TableWriter implements Closeable {
         setAppendPosition(0, false);
     }
 
+    private void addSyncRange(MemoryMA mem) {
+        if (mem != null && mem != NullMemory.INSTANCE && mem.isOpen()) {
+            syncBatch.add(mem.getFd(), 0, mem.getAppendOffset());
+        }
+    }
+
     private void syncColumns(int commitMode) {
         final boolean async = commitMode == CommitMode.ASYNC;
+        if (!async && syncBatch != null && syncColumnsBatch()) {
+            return;
+        }
         for (int i = 0; i < columnCount; i++) {
             columns.getQuick(i * 2).sync(async);
             final MemoryMA m2 = columns.getQuick(i * 2 + 1);
@@ -4879,6 +4980,24 @@ public class TableWriter implements Closeable {
         }
     }
 
+    private boolean syncColumnsBatch() {
+        syncBatch.clear();
+        for (int i = 0, n = columns.size(); i < n; i++) {
+            addSyncRange(columns.getQuick(i));
+        }
+        if (syncBatch.sync()) {
+            return true;
+        }
+        LOG.error().$("batch sync failed, falling back to msync [table=").$(tableName).I$();
+        return false;
+    }
+
+    private void takePooledFile(Path path) {
+        if (!ff.exists(path)) {
+            columnFilePool.take(path);
+        }
+    }
+
     private void throwDistressException(Throwable cause) {
         this.distressed = true;
         throw new CairoError(cause);
@@ -24,6 +24,7 @@
 
 package io.questdb.cairo.vm;
 
+import io.questdb.cairo.CairoException;
 import io.questdb.cairo.TableUtils;
 import io.questdb.cairo.vm.api.MemoryCARW;
 import io.questdb.cairo.vm.api.MemoryCMARW;
@@ -43,11 +44,20 @@ public class MemoryCMARWImpl extends AbstractMemoryCR implements MemoryCMARW, Me
     private long minMappedMemorySize = -1;
     private long extendSegmentMsb;
     private int memoryTag = MemoryTag.MMAP_DEFAULT;
+    // size of address range to reserve for the file to grow in place, 0 to remap as file grows
+    private long reserveSize;
+    // size of address range reserved by the current mapping
+    private long reservedSize;
 
     public MemoryCMARWImpl(FilesFacade ff, LPSZ name, long extendSegmentSize, long size, int memoryTag, long opts) {
         of(ff, name, extendSegmentSize, size, memoryTag, opts);
     }
 
+    public MemoryCMARWImpl(FilesFacade ff, LPSZ name, long extendSegmentSize, long size, long reserveSize, int memoryTag, long opts) {
+        this.reserveSize = reserveSize;
+        of(ff, name, extendSegmentSize, size, memoryTag, opts);
+    }
+
     public MemoryCMARWImpl() {
     }
 
@@ -80,14 +90,7 @@ public class MemoryCMARWImpl extends AbstractMemoryCR implements MemoryCMARW, Me
             try {
                 // we are remapping file to make it smaller, should not need
                 // to allocate space; we already have it
-                this.pageAddress = TableUtils.mremap(
-                        ff,
-                        fd,
-                        this.pageAddress,
-                        this.size,
-                        sz,
-                        Files.MAP_RW,
-                        memoryTag);
+                this.pageAddress = remap(this.size, sz);
             } catch (Throwable e) {
                 appendAddress = pageAddress;
                 long truncatedToSize = Vm.bestEffortTruncate(ff, LOG, fd, 0);
@@ -132,7 +135,12 @@ public class MemoryCMARWImpl extends AbstractMemoryCR implements MemoryCMARW, Me
             if (appendOffset < sz) {
                 Vect.memset(pageAddress + appendOffset, sz - appendOffset, 0);
             }
-            ff.munmap(pageAddress, size, memoryTag);
+            if (reservedSize > 0) {
+                ff.munmapReserve(pageAddress, reservedSize, size, memoryTag);
+                reservedSize = 0;
+            } else {
+                ff.munmap(pageAddress, size, memoryTag);
+            }
             this.pageAddress = 0;
             try {
                 Vm.bestEffortClose(ff, LOG, fd, truncate, truncateSize);
@@ -236,6 +244,7 @@ public class MemoryCMARWImpl extends AbstractMemoryCR implements MemoryCMARW, Me
 
     @Override
     public void replacePage(long address, long size) {
+        assert reservedSize == 0;
         long appendOffset = getAppendOffset();
         this.pageAddress = this.appendAddress = address;
         this.lim = pageAddress + size;
@@ -269,14 +278,7 @@ public class MemoryCMARWImpl extends AbstractMemoryCR implements MemoryCMARW, Me
         assert size > 0;
         TableUtils.allocateDiskSpace(ff, fd, newSize);
         try {
-            this.pageAddress = TableUtils.mremap(
-                    ff,
-                    fd,
-                    this.pageAddress,
-                    previousSize,
-                    newSize,
-                    Files.MAP_RW,
-                    memoryTag);
+            this.pageAddress = remap(previousSize, newSize);
         } catch (Throwable e) {
             appendAddress = pageAddress + previousSize;
             close(false);
@@ -310,6 +312,9 @@ public class MemoryCMARWImpl extends AbstractMemoryCR implements MemoryCMARW, Me
 
     private void map0(FilesFacade ff, long size) {
         try {
+            if (reserveSize > size && mapReserved(ff, size)) {
+                return;
+            }
             this.pageAddress = TableUtils.mapRW(ff, fd, size, memoryTag);
             this.lim = pageAddress + size;
         } catch (Throwable e) {
@@ -318,9 +323,46 @@ public class MemoryCMARWImpl extends AbstractMemoryCR implements MemoryCMARW, Me
         }
     }
 
+    private boolean mapReserved(FilesFacade ff, long size) {
+        final long address = ff.mmapReserve(reserveSize);
+        if (address == FilesFacade.MAP_FAILED) {
+            // reservation is not supported or address space is exhausted, remap as usual
+            return false;
+        }
+        TableUtils.allocateDiskSpace(ff, fd, size);
+        if (ff.mremapFixed(fd, address, 0, size, Files.MAP_RW, memoryTag) == FilesFacade.MAP_FAILED) {
+            final int errno = ff.errno();
+            ff.munmapReserve(address, reserveSize, 0, memoryTag);
+            throw CairoException.instance(errno).put("could not mmap column [fd=").put(fd).put(", size=").put(size).put(']');
+        }
+        this.pageAddress = address;
+        this.lim = address + size;
+        this.reservedSize = reserveSize;
+        return true;
+    }
+
     private void openFile(FilesFacade ff, LPSZ name, long opts) {
         close();
         this.ff = ff;
         fd = TableUtils.openFileRWOrFail(ff, name, opts);
     }
+
+    private long remap(long previousSize, long newSize) {
+        if (reservedSize == 0) {
+            return TableUtils.mremap(ff, fd, pageAddress, previousSize, newSize, Files.MAP_RW, memoryTag);
+        }
+
+        if (newSize <= reservedSize) {
+            if (ff.mremapFixed(fd, pageAddress, previousSize, newSize, Files.MAP_RW, memoryTag) == FilesFacade.MAP_FAILED) {
+                throw CairoException.instance(ff.errno()).put("could not remap file in place [previousSize=").put(previousSize).put(", newSize=").put(newSize).put(", fd=").put(fd).put(']');
+            }
+            return pageAddress;
+        }
+
+        // file outgrew reservation, map it elsewhere and remap as usual from now on
+        final long address = TableUtils.mapRW(ff, fd, newSize, memoryTag);
+        ff.munmapReserve(pageAddress, reservedSize, previousSize, memoryTag);
+        reservedSize = 0;
+        return address;
+    }
 }
@@ -46,6 +46,13 @@ public class MemoryCMRImpl extends AbstractMemoryCR implements MemoryCMR {
     public MemoryCMRImpl() {
     }
 
+    @Override
+    public void advise(int advice) {
+        if (pageAddress != 0) {
+            ff.madvise(pageAddress, size, advice);
+        }
+    }
+
     @Override
     public void close() {
         if (pageAddress != 0) {
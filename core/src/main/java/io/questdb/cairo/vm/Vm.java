@@ -131,4 +131,8 @@ public class Vm {
     public static MemoryMARW getWholeMARWInstance(FilesFacade ff, LPSZ name, long extendSegmentSize, int memoryTag, long opts) {
         return new MemoryCMARWImpl(ff, name, extendSegmentSize, -1, memoryTag, opts);
     }
+
+    public static MemoryMARW getWholeMARWInstance(FilesFacade ff, LPSZ name, long extendSegmentSize, long reserveSize, int memoryTag, long opts) {
+        return new MemoryCMARWImpl(ff, name, extendSegmentSize, -1, reserveSize, memoryTag, opts);
+    }
 }
@@ -30,6 +30,7 @@ import io.questdb.cairo.vm.Vm;
 import io.questdb.std.*;
 import io.questdb.std.str.AbstractCharSequence;
 import io.questdb.std.str.CharSink;
+import io.questdb.std.str.DirectUtf16Sequence;
 
 //contiguous readable 
 public interface MemoryCR extends MemoryC, MemoryR {
@@ -142,10 +143,15 @@ public interface MemoryCR extends MemoryC, MemoryR {
         }
     }
 
-    class CharSequenceView extends AbstractCharSequence {
+    class CharSequenceView extends AbstractCharSequence implements DirectUtf16Sequence {
         private int len;
         private long address;
 
+        @Override
+        public long getAddress() {
+            return address;
+        }
+
         @Override
         public int length() {
             return len;
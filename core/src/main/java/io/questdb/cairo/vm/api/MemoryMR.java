@@ -26,6 +26,14 @@ package io.questdb.cairo.vm.api;
 
 //mapped and readable 
 public interface MemoryMR extends MemoryM, MemoryR {
+    /**
+     * Passes access pattern hint for the mapped region to the OS.
+     *
+     * @param advice one of Files.POSIX_MADV_* or Files.MADV_* constants
+     */
+    default void advise(int advice) {
+    }
+
     default void growToFileSize() {
         extend(getFilesFacade().length(getFd()));
     }
@@ -86,6 +86,11 @@ public class DefaultHttpContextConfiguration implements HttpContextConfiguration
         return 4096;
     }
 
+    @Override
+    public int getResponseHeaderBufferSize() {
+        return getSendBufferSize();
+    }
+
     @Override
     public int getSendBufferSize() {
         return 1024 * 1024;
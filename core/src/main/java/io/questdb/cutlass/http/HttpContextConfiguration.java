@@ -54,6 +54,12 @@ public interface HttpContextConfiguration {
 
     int getRequestHeaderBufferSize();
 
+    /**
+     * @return size of the buffer response headers are staged in before they are sent
+     * along with the body, usually the same as send buffer size
+     */
+    int getResponseHeaderBufferSize();
+
     int getSendBufferSize();
 
     boolean getServerKeepAlive();
@@ -33,4 +33,11 @@ public interface HttpRawSocket {
     int getBufferSize();
 
     void send(int size) throws PeerDisconnectedException, PeerIsSlowToReadException;
+
+    /**
+     * Sends part of a file straight from the page cache. Header, when ready, is sent first.
+     *
+     * @return number of bytes of the file that have been sent, always positive
+     */
+    long sendFile(long fd, long offset, long len) throws PeerDisconnectedException, PeerIsSlowToReadException;
 }
@@ -24,15 +24,18 @@
 
 package io.questdb.cutlass.http;
 
+import io.questdb.cutlass.json.JsonNative;
 import io.questdb.log.Log;
 import io.questdb.log.LogFactory;
 import io.questdb.network.*;
 import io.questdb.std.*;
 import io.questdb.std.datetime.millitime.DateFormatUtils;
+import io.questdb.std.datetime.microtime.Timestamps;
 import io.questdb.std.datetime.millitime.MillisecondClock;
 import io.questdb.std.ex.ZLibException;
 import io.questdb.std.str.AbstractCharSink;
 import io.questdb.std.str.CharSink;
+import io.questdb.std.str.DirectUtf16Sequence;
 import io.questdb.std.str.StdoutSink;
 
 import java.io.Closeable;
@@ -52,7 +55,17 @@ public class HttpResponseSink implements Closeable, Mutable {
         httpStatusMap.put(500, "Internal server error");
     }
 
+    // strings shorter than that are not worth JNI call
+    private static final int NATIVE_COPY_MIN_LEN = 32;
+    // 1000-01-01T00:00:00.000000Z and 10000-01-01T00:00:00.000000Z, ISO dates with 4 digit years
+    // are written directly to buffer
+    private static final long ISO_DATE_MICROS_LO = -30610224000000000L;
+    private static final long ISO_DATE_MICROS_LIMIT = 253402300800000000L;
     private final ChunkBuffer buffer;
+    // response header is kept apart from the body, so that both can be sent in one system call
+    private final ChunkBuffer headerBuffer;
+    // (address, length) pairs of header and body
+    private final long iov;
     private ChunkBuffer compressOutBuffer;
     private final HttpResponseHeaderImpl headerImpl;
     private final SimpleResponseImpl simple = new SimpleResponseImpl();
@@ -71,6 +84,8 @@ public class HttpResponseSink implements Closeable, Mutable {
     private long totalBytesSent = 0;
     private final boolean connectionCloseHeader;
     private boolean headersSent;
+    // header is complete and waits to be sent together with the body
+    private boolean headerReady;
     private boolean chunkedRequestDone;
     private boolean compressedHeaderDone;
     private boolean compressedOutputReady;
@@ -80,6 +95,8 @@ public class HttpResponseSink implements Closeable, Mutable {
         this.responseBufferSize = Numbers.ceilPow2(configuration.getSendBufferSize());
         this.nf = configuration.getNetworkFacade();
         this.buffer = new ChunkBuffer(responseBufferSize);
+        this.headerBuffer = new ChunkBuffer(Numbers.ceilPow2(configuration.getResponseHeaderBufferSize()));
+        this.iov = Unsafe.malloc(4 * Long.BYTES, MemoryTag.NATIVE_HTTP_CONN);
         this.headerImpl = new HttpResponseHeaderImpl(configuration.getClock());
         this.dumpNetworkTraffic = configuration.getDumpNetworkTraffic();
         this.httpVersion = configuration.getHttpVersion();
@@ -93,8 +110,10 @@ public class HttpResponseSink implements Closeable, Mutable {
     @Override
     public void clear() {
         headerImpl.clear();
+        buffer.clearAndPrepareToWriteToBuffer();
         totalBytesSent = 0;
         headersSent = false;
+        headerReady = false;
         chunkedRequestDone = false;
         resetZip();
     }
@@ -108,6 +127,8 @@ public class HttpResponseSink implements Closeable, Mutable {
             compressOutBuffer = null;
         }
         buffer.close();
+        headerBuffer.close();
+        Unsafe.free(iov, 4 * Long.BYTES, MemoryTag.NATIVE_HTTP_CONN);
     }
 
     public void setDeflateBeforeSend(boolean deflateBeforeSend) {
@@ -240,8 +261,8 @@ public class HttpResponseSink implements Closeable, Mutable {
     }
 
     private void prepareHeaderSink() {
-        buffer.prepareToReadFromBuffer(false, false);
         headerImpl.prepareToSend();
+        headerReady = true;
     }
 
     private void resetZip() {
@@ -257,6 +278,9 @@ public class HttpResponseSink implements Closeable, Mutable {
     }
 
     private void sendBuffer(ChunkBuffer sendBuf) throws PeerDisconnectedException, PeerIsSlowToReadException {
+        if (headerReady) {
+            sendHeaderAndBuffer(sendBuf);
+        }
         int nSend = (int) sendBuf.getReadNAvailable();
         while (nSend > 0) {
             int n = nf.send(fd, sendBuf.getReadAddress(), nSend);
@@ -282,6 +306,44 @@ public class HttpResponseSink implements Closeable, Mutable {
         sendBuf.clearAndPrepareToWriteToBuffer();
     }
 
+    private void sendHeaderAndBuffer(ChunkBuffer sendBuf) throws PeerDisconnectedException, PeerIsSlowToReadException {
+        int nHeader;
+        while ((nHeader = (int) headerBuffer.getReadNAvailable()) > 0) {
+            final int nBody = (int) sendBuf.getReadNAvailable();
+            final int n;
+            if (nBody > 0) {
+                Unsafe.getUnsafe().putLong(iov, headerBuffer.getReadAddress());
+                Unsafe.getUnsafe().putLong(iov + Long.BYTES, nHeader);
+                Unsafe.getUnsafe().putLong(iov + 2 * Long.BYTES, sendBuf.getReadAddress());
+                Unsafe.getUnsafe().putLong(iov + 3 * Long.BYTES, nBody);
+                n = nf.sendv(fd, iov, 2);
+            } else {
+                n = nf.send(fd, headerBuffer.getReadAddress(), nHeader);
+            }
+            if (n < 0) {
+                // disconnected
+                LOG.error()
+                        .$("disconnected [errno=").$(nf.errno())
+                        .$(", fd=").$(fd)
+                        .$(']').$();
+                throw PeerDisconnectedException.INSTANCE;
+            }
+            if (n == 0) {
+                throw PeerIsSlowToReadException.INSTANCE;
+            }
+            final int nHeaderSent = Math.min(n, nHeader);
+            dumpBuffer(headerBuffer.getReadAddress(), nHeaderSent);
+            headerBuffer.onRead(nHeaderSent);
+            if (n > nHeaderSent) {
+                dumpBuffer(sendBuf.getReadAddress(), n - nHeaderSent);
+                sendBuf.onRead(n - nHeaderSent);
+            }
+            totalBytesSent += n;
+        }
+        headerBuffer.clearAndPrepareToWriteToBuffer();
+        headerReady = false;
+    }
+
     private void dumpBuffer(long buffer, int size) {
         if (dumpNetworkTraffic && size > 0) {
             StdoutSink.INSTANCE.put('<');
@@ -304,7 +366,7 @@ public class HttpResponseSink implements Closeable, Mutable {
 
         @Override
         public void clear() {
-            buffer.clearAndPrepareToWriteToBuffer();
+            headerBuffer.clearAndPrepareToWriteToBuffer();
             chunky = false;
         }
 
@@ -316,15 +378,15 @@ public class HttpResponseSink implements Closeable, Mutable {
         @Override
         public CharSink put(CharSequence cs) {
             int len = cs.length();
-            Chars.asciiStrCpy(cs, len, buffer.getWriteAddress(len));
-            buffer.onWrite(len);
+            Chars.asciiStrCpy(cs, len, headerBuffer.getWriteAddress(len));
+            headerBuffer.onWrite(len);
             return this;
         }
 
         @Override
         public CharSink put(char c) {
-            Unsafe.getUnsafe().putByte(buffer.getWriteAddress(1), (byte) c);
-            buffer.onWrite(1);
+            Unsafe.getUnsafe().putByte(headerBuffer.getWriteAddress(1), (byte) c);
+            headerBuffer.onWrite(1);
             return this;
         }
 
@@ -335,7 +397,7 @@ public class HttpResponseSink implements Closeable, Mutable {
 
         @Override
         public void send() throws PeerDisconnectedException, PeerIsSlowToReadException {
-            headerImpl.prepareToSend();
+            prepareHeaderSink();
             flushSingle();
         }
 
@@ -346,7 +408,10 @@ public class HttpResponseSink implements Closeable, Mutable {
             if (status == null) {
                 throw new IllegalArgumentException("Illegal status code: " + code);
             }
+            // new response, discard whatever was staged for the previous one
             buffer.clearAndPrepareToWriteToBuffer();
+            headerBuffer.clearAndPrepareToWriteToBuffer();
+            headerReady = false;
             put(httpProtocolVersion).put(code).put(' ').put(status).put(Misc.EOL);
             put("Server: ").put("questDB/1.0").put(Misc.EOL);
             put("Date: ");
@@ -384,9 +449,8 @@ public class HttpResponseSink implements Closeable, Mutable {
         public void sendStatus(int code, CharSequence message) throws PeerDisconnectedException, PeerIsSlowToReadException {
             buffer.clearAndPrepareToWriteToBuffer();
             final String std = headerImpl.status(httpVersion, code, "text/plain; charset=utf-8", -1L);
+            // header goes out with the message
             prepareHeaderSink();
-            flushSingle();
-            buffer.clearAndPrepareToWriteToBuffer();
             sink.put(message == null ? std : message).put(Misc.EOL);
             buffer.prepareToReadFromBuffer(true, true);
             resumeSend();
@@ -405,6 +469,54 @@ public class HttpResponseSink implements Closeable, Mutable {
     }
 
     private class ResponseSinkImpl extends AbstractCharSink {
+        // calendar date of the last day ISO date was written for
+        private long isoDayLo = Long.MIN_VALUE;
+        private int isoYear;
+        private int isoMonth;
+        private int isoDay;
+
+        @Override
+        public CharSink encodeUtf8AndQuote(CharSequence cs) {
+            final int len = cs.length();
+            // UTF-8 encoding and escaping take up to three bytes per char
+            if (buffer.getWriteNAvailable() < 3L * len + 2) {
+                return super.encodeUtf8AndQuote(cs);
+            }
+
+            final long address = cs instanceof DirectUtf16Sequence ? ((DirectUtf16Sequence) cs).getAddress() : 0;
+            long p = buffer._wptr;
+            Unsafe.getUnsafe().putByte(p++, (byte) '"');
+            int i = 0;
+            while (i < len) {
+                if (address != 0 && len - i >= NATIVE_COPY_MIN_LEN) {
+                    final int n = (int) JsonNative.copyPlainUtf16(address + 2L * i, len - i, p);
+                    i += n;
+                    p += n;
+                    if (i == len) {
+                        break;
+                    }
+                }
+
+                final char c = cs.charAt(i++);
+                if (c < 128) {
+                    p = putUtf8Special(p, c);
+                } else if (c < 2048) {
+                    Unsafe.getUnsafe().putByte(p++, (byte) (192 | c >> 6));
+                    Unsafe.getUnsafe().putByte(p++, (byte) (128 | c & 63));
+                } else if (Character.isSurrogate(c)) {
+                    buffer._wptr = p;
+                    i = encodeSurrogate(c, cs, i, len);
+                    p = buffer._wptr;
+                } else {
+                    Unsafe.getUnsafe().putByte(p++, (byte) (224 | c >> 12));
+                    Unsafe.getUnsafe().putByte(p++, (byte) (128 | c >> 6 & 63));
+                    Unsafe.getUnsafe().putByte(p++, (byte) (128 | c & 63));
+                }
+            }
+            Unsafe.getUnsafe().putByte(p++, (byte) '"');
+            buffer._wptr = p;
+            return this;
+        }
 
         @Override
         public CharSink put(CharSequence seq) {
@@ -448,6 +560,24 @@ public class HttpResponseSink implements Closeable, Mutable {
             return super.put(value, scale);
         }
 
+        @Override
+        public CharSink putISODate(long value) {
+            if (value >= ISO_DATE_MICROS_LO && value < ISO_DATE_MICROS_LIMIT && buffer.getWriteNAvailable() >= 27) {
+                buffer._wptr = putISODate(buffer._wptr, value, true);
+                return this;
+            }
+            return super.putISODate(value);
+        }
+
+        @Override
+        public CharSink putISODateMillis(long value) {
+            if (value >= ISO_DATE_MICROS_LO / 1000 && value < ISO_DATE_MICROS_LIMIT / 1000 && buffer.getWriteNAvailable() >= 24) {
+                buffer._wptr = putISODate(buffer._wptr, value * 1000, false);
+                return this;
+            }
+            return super.putISODateMillis(value);
+        }
+
         @Override
         public void putUtf8Special(char c) {
             if (c < 32) {
@@ -495,6 +625,85 @@ public class HttpResponseSink implements Closeable, Mutable {
                     break;
             }
         }
+
+        private long put0(long p, int value) {
+            Unsafe.getUnsafe().putByte(p, (byte) ('0' + value / 10));
+            Unsafe.getUnsafe().putByte(p + 1, (byte) ('0' + value % 10));
+            return p + 2;
+        }
+
+        private long put0(long p, int value, int digits) {
+            for (int i = digits - 1; i > -1; i--) {
+                Unsafe.getUnsafe().putByte(p + i, (byte) ('0' + value % 10));
+                value /= 10;
+            }
+            return p + digits;
+        }
+
+        private long putEscaped(long p, char c) {
+            Unsafe.getUnsafe().putByte(p, (byte) '\\');
+            Unsafe.getUnsafe().putByte(p + 1, (byte) c);
+            return p + 2;
+        }
+
+        // same output as yyyy-MM-ddTHH:mm:ss.SSSUUUZ and yyyy-MM-ddTHH:mm:ss.SSSZ formats, results
+        // are mostly sorted by time, so calendar date is only computed when the day changes
+        private long putISODate(long p, long micros, boolean usec) {
+            // Long.MIN_VALUE is never a start of the day, it marks that no date is cached yet
+            if (isoDayLo == Long.MIN_VALUE || micros < isoDayLo || micros - isoDayLo >= Timestamps.DAY_MICROS) {
+                isoDayLo = Math.floorDiv(micros, Timestamps.DAY_MICROS) * Timestamps.DAY_MICROS;
+                isoYear = Timestamps.getYear(isoDayLo);
+                final boolean leap = Timestamps.isLeapYear(isoYear);
+                isoMonth = Timestamps.getMonthOfYear(isoDayLo, isoYear, leap);
+                isoDay = Timestamps.getDayOfMonth(isoDayLo, isoYear, isoMonth, leap);
+            }
+
+            final long time = micros - isoDayLo;
+            final int seconds = (int) (time / Timestamps.SECOND_MICROS);
+            final int fraction = (int) (time % Timestamps.SECOND_MICROS);
+
+            p = put0(p, isoYear, 4);
+            Unsafe.getUnsafe().putByte(p++, (byte) '-');
+            p = put0(p, isoMonth);
+            Unsafe.getUnsafe().putByte(p++, (byte) '-');
+            p = put0(p, isoDay);
+            Unsafe.getUnsafe().putByte(p++, (byte) 'T');
+            p = put0(p, seconds / 3600);
+            Unsafe.getUnsafe().putByte(p++, (byte) ':');
+            p = put0(p, seconds / 60 % 60);
+            Unsafe.getUnsafe().putByte(p++, (byte) ':');
+            p = put0(p, seconds % 60);
+            Unsafe.getUnsafe().putByte(p++, (byte) '.');
+            p = usec ? put0(p, fraction, 6) : put0(p, fraction / 1000, 3);
+            Unsafe.getUnsafe().putByte(p++, (byte) 'Z');
+            return p;
+        }
+
+        // byte-level equivalent of putUtf8Special(char)
+        private long putUtf8Special(long p, char c) {
+            if (c < 32) {
+                switch (c) {
+                    case '\0':
+                        return p;
+                    case '\b':
+                        return putEscaped(p, 'b');
+                    case '\f':
+                        return putEscaped(p, 'f');
+                    case '\n':
+                        return putEscaped(p, 'n');
+                    case '\r':
+                        return putEscaped(p, 'r');
+                    case '\t':
+                        return putEscaped(p, 't');
+                    default:
+                        break;
+                }
+            } else if (c == '/' || c == '\"' || c == '\\') {
+                return putEscaped(p, c);
+            }
+            Unsafe.getUnsafe().putByte(p, (byte) c);
+            return p + 1;
+        }
     }
 
     public class HttpRawSocketImpl implements HttpRawSocket {
@@ -516,6 +725,35 @@ public class HttpResponseSink implements Closeable, Mutable {
             flushSingle();
             buffer.clearAndPrepareToWriteToBuffer();
         }
+
+        @Override
+        public long sendFile(long fileFd, long offset, long len) throws PeerDisconnectedException, PeerIsSlowToReadException {
+            if (headerReady) {
+                flushSingle();
+            }
+            final long n = nf.sendFile(fileFd, fd, offset, len);
+            if (n == Net.EEOF) {
+                // file got shorter than the length that has been promised to the client, response cannot be completed
+                LOG.error()
+                        .$("file is truncated, disconnecting [fd=").$(fd)
+                        .$(", offset=").$(offset)
+                        .$(", len=").$(len)
+                        .$(']').$();
+                throw PeerDisconnectedException.INSTANCE;
+            }
+            if (n < 0) {
+                LOG.error()
+                        .$("disconnected [errno=").$(nf.errno())
+                        .$(", fd=").$(fd)
+                        .$(']').$();
+                throw PeerDisconnectedException.INSTANCE;
+            }
+            if (n == 0) {
+                throw PeerIsSlowToReadException.INSTANCE;
+            }
+            totalBytesSent += n;
+            return n;
+        }
     }
 
     private class ChunkedResponseImpl extends ResponseSinkImpl implements HttpChunkedResponseSocket {
@@ -559,8 +797,8 @@ public class HttpResponseSink implements Closeable, Mutable {
         @Override
         public void sendHeader() throws PeerDisconnectedException, PeerIsSlowToReadException {
             chunkedRequestDone = false;
+            // header is sent with the first chunk
             prepareHeaderSink();
-            flushSingle();
             buffer.clearAndPrepareToWriteToBuffer();
         }
 
@@ -108,17 +108,9 @@ public class StaticContentProcessor implements HttpRequestProcessor, Closeable {
         }
 
         final HttpRawSocket socket = context.getRawResponseSocket();
-        long address = socket.getBufferAddress();
-        int size = socket.getBufferSize();
-
-        long l;
-        // todo: check what happens when this code cannot read file
-        while (state.bytesSent < state.sendMax && (l = ff.read(state.fd, address, size, state.bytesSent)) > 0) {
-            if (l + state.bytesSent > state.sendMax) {
-                l = state.sendMax - state.bytesSent;
-            }
-            state.bytesSent += l;
-            socket.send((int) l);
+        // file is never copied into response buffer, data goes from page cache to socket
+        while (state.bytesSent < state.sendMax) {
+            state.bytesSent += socket.sendFile(state.fd, state.bytesSent, state.sendMax - state.bytesSent);
         }
     }
 
@@ -0,0 +1,40 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.cutlass.json;
+
+public class JsonNative {
+
+    /**
+     * Copies leading run of UTF-16 chars that go into JSON string as is, narrowing each of them
+     * to a single byte. These are printable ASCII chars other than quote, backslash and forward slash.
+     * The char the copy stops at has to be escaped or UTF-8 encoded by the caller.
+     *
+     * @param src address of the first UTF-16 char
+     * @param len number of chars at src
+     * @param dst address to copy to, up to len bytes may be written
+     * @return number of chars copied
+     */
+    public static native long copyPlainUtf16(long src, long len, long dst);
+}
@@ -153,6 +153,11 @@ public class DefaultLineTcpReceiverConfiguration implements LineTcpReceiverConfi
         return false;
     }
 
+    @Override
+    public boolean isListenerPerWorkerEnabled() {
+        return false;
+    }
+
     @Override
     public boolean isSymbolAsFieldSupported() {
         return false;
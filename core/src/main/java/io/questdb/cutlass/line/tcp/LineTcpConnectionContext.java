@@ -58,6 +58,9 @@ class LineTcpConnectionContext implements IOContext, Mutable {
     protected long recvBufPos;
     protected boolean peerDisconnected;
     protected long recvBufStartOfMeasurement;
+    // one bit per byte of receive buffer, marks bytes parser cannot skip over
+    private long structuralBitmap;
+    private final long structuralBitmapSize;
     private long lastQueueFullLogMillis = 0;
     private boolean goodMeasurement;
 
@@ -70,6 +73,9 @@ class LineTcpConnectionContext implements IOContext, Mutable {
         parser = new LineTcpParser(configuration.isStringAsTagSupported(), configuration.isSymbolAsFieldSupported());
         recvBufStart = Unsafe.malloc(configuration.getNetMsgBufferSize(), MemoryTag.NATIVE_DEFAULT);
         recvBufEnd = recvBufStart + configuration.getNetMsgBufferSize();
+        structuralBitmapSize = ((configuration.getNetMsgBufferSize() + 63L) >>> 6) << 3;
+        structuralBitmap = Unsafe.malloc(structuralBitmapSize, MemoryTag.NATIVE_DEFAULT);
+        parser.withStructuralIndex(recvBufStart, structuralBitmap);
         clear();
     }
 
@@ -85,6 +91,8 @@ class LineTcpConnectionContext implements IOContext, Mutable {
         this.fd = -1;
         Unsafe.free(recvBufStart, recvBufEnd - recvBufStart, MemoryTag.NATIVE_DEFAULT);
         recvBufStart = recvBufEnd = recvBufPos = 0;
+        Unsafe.free(structuralBitmap, structuralBitmapSize, MemoryTag.NATIVE_DEFAULT);
+        structuralBitmap = 0;
         floatingDirectCharSink.close();
     }
 
@@ -128,6 +136,7 @@ class LineTcpConnectionContext implements IOContext, Mutable {
             final long len = recvBufPos - recvBufStartOfMeasurement;
             if (len > 0) {
                 Vect.memmove(recvBufStart, recvBufStartOfMeasurement, len); // Use memmove, there may be an overlap
+                scanStructural(recvBufStart, recvBufStart + len);
                 final long shl = recvBufStartOfMeasurement - recvBufStart;
                 parser.shl(shl);
                 this.recvBufStartOfMeasurement -= shl;
@@ -265,6 +274,7 @@ class LineTcpConnectionContext implements IOContext, Mutable {
         if (bufferRemaining > 0 && !peerDisconnected) {
             int bytesRead = nf.recv(fd, recvBufPos, bufferRemaining);
             if (bytesRead > 0) {
+                scanStructural(recvBufPos, recvBufPos + bytesRead);
                 recvBufPos += bytesRead;
                 bufferRemaining -= bytesRead;
             } else {
@@ -275,6 +285,16 @@ class LineTcpConnectionContext implements IOContext, Mutable {
         return !peerDisconnected;
     }
 
+    /**
+     * Updates structural bitmap for newly arrived bytes. Scan starts at the beginning of the bitmap word
+     * the range falls into. Bytes before the range in the same word are either unchanged or already
+     * consumed by the parser, so re-scanning them is harmless.
+     */
+    private void scanStructural(long lo, long hi) {
+        final long offset = (lo - recvBufStart) & ~63L;
+        LineTcpParserNative.structuralScan(recvBufStart + offset, hi - recvBufStart - offset, structuralBitmap + (offset >>> 3));
+    }
+
     protected void resetParser() {
         parser.of(recvBufStart);
         goodMeasurement = true;
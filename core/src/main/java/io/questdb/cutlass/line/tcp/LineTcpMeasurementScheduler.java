@@ -70,7 +70,7 @@ class LineTcpMeasurementScheduler implements Closeable {
             LineTcpReceiverConfiguration lineConfiguration,
             CairoEngine engine,
             WorkerPool ioWorkerPool,
-            IODispatcher<LineTcpConnectionContext> dispatcher,
+            ObjList<IODispatcher<LineTcpConnectionContext>> dispatchers,
             WorkerPool writerWorkerPool
     ) {
         this.engine = engine;
@@ -84,7 +84,8 @@ class LineTcpMeasurementScheduler implements Closeable {
         this.tableNameSinks = new StringSink[n];
         for (int i = 0; i < n; i++) {
             tableNameSinks[i] = new StringSink();
-            NetworkIOJob netIoJob = createNetworkIOJob(dispatcher, i);
+            // either all workers share single dispatcher or each worker owns one
+            NetworkIOJob netIoJob = createNetworkIOJob(dispatchers.getQuick(i % dispatchers.size()), i);
             netIoJobs[i] = netIoJob;
             ioWorkerPool.assign(i, netIoJob);
             ioWorkerPool.assign(i, netIoJob::close);
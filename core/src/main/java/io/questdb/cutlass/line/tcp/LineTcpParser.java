@@ -31,6 +31,7 @@ import io.questdb.std.Numbers;
 import io.questdb.std.NumericException;
 import io.questdb.std.ObjList;
 import io.questdb.std.Unsafe;
+import io.questdb.std.Vect;
 import io.questdb.std.str.DirectByteCharSequence;
 
 public class LineTcpParser {
@@ -86,6 +87,9 @@ public class LineTcpParser {
     private boolean nextValueCanBeOpenQuote;
     private final EntityHandler entityNameHandler = this::expectEntityName;
     private boolean hasNonAscii;
+    // optional bitmap of bytes that cannot be skipped over, see LineTcpParserNative
+    private long structuralLo;
+    private long structuralBitmap;
 
     public LineTcpParser(boolean stringAsTagSupported, boolean symbolAsFieldSupported) {
         this.stringAsTagSupported = stringAsTagSupported;
@@ -154,6 +158,16 @@ public class LineTcpParser {
 
         // Main parsing loop
         while (bufAt < bufHi) {
+            if (structuralBitmap != 0) {
+                // bytes up to the next structural byte are part of the current entity
+                final long next = nextStructural(bufHi);
+                if (next > bufAt) {
+                    skipTo(next);
+                    if (bufAt == bufHi) {
+                        break;
+                    }
+                }
+            }
             // take the byte
             byte b = Unsafe.getUnsafe().getByte(bufAt);
             hasNonAscii |= b < 0;
@@ -312,6 +326,18 @@ public class LineTcpParser {
         hasNonAscii = false;
     }
 
+    /**
+     * Lets the parser skip over runs of bytes that do not need individual handling.
+     *
+     * @param bufLo  address of the buffer the bitmap was computed for
+     * @param bitmap address of bitmap, produced by {@link LineTcpParserNative#structuralScan(long, long, long)}
+     *               and kept up to date with buffer content by the caller
+     */
+    public void withStructuralIndex(long bufLo, long bitmap) {
+        this.structuralLo = bufLo;
+        this.structuralBitmap = bitmap;
+    }
+
     private boolean expectEndOfLine(byte endOfEntityByte, long bufHi) {
         assert endOfEntityByte == '\n';
         return true;
@@ -430,7 +456,11 @@ public class LineTcpParser {
         try {
             if (endOfEntityByte == (byte) '\n') {
                 if (entityLo < bufAt - nEscapedChars) {
-                    timestamp = Numbers.parseLong(charSeq.of(entityLo, bufAt - nEscapedChars));
+                    final long hi = bufAt - nEscapedChars;
+                    timestamp = Numbers.parseDecimalLong(entityLo, hi);
+                    if (timestamp == Numbers.LONG_NaN) {
+                        timestamp = Numbers.parseLong(charSeq.of(entityLo, hi));
+                    }
                 }
                 entityHandler = null;
                 return true;
@@ -454,6 +484,22 @@ public class LineTcpParser {
         return ParseResult.ERROR;
     }
 
+    private long nextStructural(long bufHi) {
+        long offset = bufAt - structuralLo;
+        long word = Unsafe.getUnsafe().getLong(structuralBitmap + ((offset >>> 6) << 3)) >>> (offset & 63);
+        if (word != 0) {
+            return Math.min(bufAt + Long.numberOfTrailingZeros(word), bufHi);
+        }
+
+        for (offset = (offset | 63) + 1; structuralLo + offset < bufHi; offset += 64) {
+            word = Unsafe.getUnsafe().getLong(structuralBitmap + ((offset >>> 6) << 3));
+            if (word != 0) {
+                return Math.min(structuralLo + offset + Long.numberOfTrailingZeros(word), bufHi);
+            }
+        }
+        return bufHi;
+    }
+
     private boolean prepareQuotedEntity(long openQuoteIdx, long bufHi) {
         // the byte at openQuoteIdx (bufAt + 1) is '"', from here it can only be
         // the start of a string value. Get it ready for immediate consumption by
@@ -504,6 +550,15 @@ public class LineTcpParser {
         return false; // missing tail quote as the string extends past the max allowed size
     }
 
+    private void skipTo(long next) {
+        // same as appending bytes one by one in the main loop
+        if (nEscapedChars > 0) {
+            Vect.memmove(bufAt - nEscapedChars, bufAt, next - bufAt);
+        }
+        bufAt = next;
+        nextValueCanBeOpenQuote = false;
+    }
+
     public enum ParseResult {
         MEASUREMENT_COMPLETE, BUFFER_UNDERFLOW, ERROR
     }
@@ -629,6 +684,11 @@ public class LineTcpParser {
                     return true;
                 }
                 default:
+                    floatValue = Numbers.parseDecimalDouble(value.getLo(), value.getHi());
+                    if (!Double.isNaN(floatValue)) {
+                        type = ENTITY_TYPE_FLOAT;
+                        return true;
+                    }
                     try {
                         floatValue = Numbers.parseDouble(value);
                         type = ENTITY_TYPE_FLOAT;
@@ -641,8 +701,11 @@ public class LineTcpParser {
 
         private boolean parseLong(byte entityType) {
             try {
-                charSeq.of(value.getLo(), value.getHi() - 1);
-                longValue = Numbers.parseLong(charSeq);
+                final long hi = value.getHi() - 1;
+                longValue = Numbers.parseDecimalLong(value.getLo(), hi);
+                if (longValue == Numbers.LONG_NaN) {
+                    longValue = Numbers.parseLong(charSeq.of(value.getLo(), hi));
+                }
                 value.decHi(); // remove 'i'
                 type = entityType;
             } catch (NumericException notANumber) {
@@ -31,9 +31,7 @@ import io.questdb.log.Log;
 import io.questdb.log.LogFactory;
 import io.questdb.mp.EagerThreadSetup;
 import io.questdb.mp.WorkerPool;
-import io.questdb.network.IOContextFactory;
-import io.questdb.network.IODispatcher;
-import io.questdb.network.IODispatchers;
+import io.questdb.network.*;
 import io.questdb.std.ThreadLocal;
 import io.questdb.std.*;
 import io.questdb.std.str.Path;
@@ -44,7 +42,7 @@ import java.io.Closeable;
 
 public class LineTcpReceiver implements Closeable {
     private static final Log LOG = LogFactory.getLog(LineTcpReceiver.class);
-    private final IODispatcher<LineTcpConnectionContext> dispatcher;
+    private final ObjList<IODispatcher<LineTcpConnectionContext>> dispatchers = new ObjList<>();
     private final LineTcpConnectionContextFactory contextFactory;
     private final LineTcpMeasurementScheduler scheduler;
     private final ObjList<WorkerPool> dedicatedPools;
@@ -58,13 +56,36 @@ public class LineTcpReceiver implements Closeable {
             ObjList<WorkerPool> dedicatedPools
     ) {
         this.contextFactory = new LineTcpConnectionContextFactory(lineConfiguration);
-        this.dispatcher = IODispatchers.create(
-                lineConfiguration.getDispatcherConfiguration(),
-                contextFactory
-        );
+        final IODispatcherConfiguration dispatcherConfiguration = lineConfiguration.getDispatcherConfiguration();
+        final int ioWorkerCount = ioWorkerPool.getWorkerCount();
+        if (lineConfiguration.isListenerPerWorkerEnabled() && ioWorkerCount > 1 && (Os.type == Os.LINUX_AMD64 || Os.type == Os.LINUX_ARM64)) {
+            // shared-nothing mode: each worker accepts and serves its own connections,
+            // kernel spreads connections across listeners of the SO_REUSEPORT group;
+            // only Linux balances such group, other OSes favour single listener
+            try {
+                for (int i = 0; i < ioWorkerCount; i++) {
+                    final IODispatcher<LineTcpConnectionContext> dispatcher = IODispatchers.create(
+                            new ReusePortIODispatcherConfiguration(dispatcherConfiguration, ioWorkerPool.getWorkerAffinity(i)),
+                            contextFactory
+                    );
+                    dispatchers.add(dispatcher);
+                    ioWorkerPool.assign(i, dispatcher);
+                }
+            } catch (Throwable e) {
+                Misc.freeObjList(dispatchers);
+                throw e;
+            }
+            LOG.info().$("listener per worker [workers=").$(ioWorkerCount).I$();
+        } else {
+            final IODispatcher<LineTcpConnectionContext> dispatcher = IODispatchers.create(
+                    dispatcherConfiguration,
+                    contextFactory
+            );
+            dispatchers.add(dispatcher);
+            ioWorkerPool.assign(dispatcher);
+        }
         this.dedicatedPools = dedicatedPools;
-        ioWorkerPool.assign(dispatcher);
-        this.scheduler = new LineTcpMeasurementScheduler(lineConfiguration, engine, ioWorkerPool, dispatcher, writerWorkerPool);
+        this.scheduler = new LineTcpMeasurementScheduler(lineConfiguration, engine, ioWorkerPool, dispatchers, writerWorkerPool);
         this.metrics = engine.getMetrics();
 
         final Closeable cleaner = contextFactory::closeContextPool;
@@ -117,7 +138,12 @@ public class LineTcpReceiver implements Closeable {
         }
         Misc.free(scheduler);
         Misc.free(contextFactory);
-        Misc.free(dispatcher);
+        Misc.freeObjList(dispatchers);
+    }
+
+    @TestOnly
+    int getDispatcherCount() {
+        return dispatchers.size();
     }
 
     @TestOnly
@@ -78,6 +78,12 @@ public interface LineTcpReceiverConfiguration {
 
     boolean isEnabled();
 
+    /**
+     * @return true to give each IO worker its own listener on the shared port, so that
+     * connections are accepted and served by the same worker without hand-offs
+     */
+    boolean isListenerPerWorkerEnabled();
+
     boolean getDisconnectOnError();
 
     long getSymbolCacheWaitUsBeforeReload();
@@ -138,6 +138,9 @@ public abstract class AbstractLineProtoUdpReceiver extends SynchronizedJob imple
     }
 
     private void bind(LineUdpReceiverConfiguration configuration) {
+        if (configuration.getShardCount() > 1 && configuration.isUnicast() && nf.setReusePort(fd) != 0) {
+            LOG.error().$("could not set SO_REUSEPORT [fd=").$(fd).$(", errno=").$(nf.errno()).I$();
+        }
         if (nf.bindUdp(fd, configuration.isUnicast() ? configuration.getBindIPv4Address() : 0, configuration.getPort())) {
             if (!configuration.isUnicast() && !nf.join(fd, configuration.getBindIPv4Address(), configuration.getGroupIPv4Address())) {
                 throw NetworkError.instance(nf.errno())
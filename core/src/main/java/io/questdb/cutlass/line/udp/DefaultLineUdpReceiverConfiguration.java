@@ -87,6 +87,16 @@ public class DefaultLineUdpReceiverConfiguration implements LineUdpReceiverConfi
         return -1;
     }
 
+    @Override
+    public int getReceiveBufferMaxSize() {
+        return -1;
+    }
+
+    @Override
+    public int getShardCount() {
+        return 1;
+    }
+
     @Override
     public CairoSecurityContext getCairoSecurityContext() {
         return AllowAllCairoSecurityContext.INSTANCE;
@@ -97,6 +107,11 @@ public class DefaultLineUdpReceiverConfiguration implements LineUdpReceiverConfi
         return true;
     }
 
+    @Override
+    public boolean isGroEnabled() {
+        return false;
+    }
+
     @Override
     public boolean isUnicast() {
         return false;
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.cutlass.line.udp;
+
+import io.questdb.metrics.Counter;
+import io.questdb.metrics.MetricsRegistry;
+
+public class LineUdpMetrics {
+
+    private final Counter datagramCounter;
+    // datagrams kernel dropped because receive buffer was full
+    private final Counter dropCounter;
+
+    public LineUdpMetrics(MetricsRegistry metricsRegistry) {
+        this.datagramCounter = metricsRegistry.newCounter("line_udp_datagrams");
+        this.dropCounter = metricsRegistry.newCounter("line_udp_drops");
+    }
+
+    public void addDatagrams(long count) {
+        datagramCounter.add(count);
+    }
+
+    public void addDrops(long count) {
+        dropCounter.add(count);
+    }
+
+    public long datagramCount() {
+        return datagramCounter.get();
+    }
+
+    public long dropCount() {
+        return dropCounter.get();
+    }
+}
@@ -48,10 +48,25 @@ public interface LineUdpReceiverConfiguration {
 
     int getReceiveBufferSize();
 
+    /**
+     * @return size receive buffer is allowed to grow to when kernel drops datagrams, -1 to keep it fixed
+     */
+    int getReceiveBufferMaxSize();
+
+    /**
+     * @return number of unicast sockets sharing the port, each drained by its own worker
+     */
+    int getShardCount();
+
     CairoSecurityContext getCairoSecurityContext();
 
     boolean isEnabled();
 
+    /**
+     * @return true to let kernel coalesce datagrams into messages of up to 64KB
+     */
+    boolean isGroEnabled();
+
     boolean isUnicast();
 
     boolean ownThread();
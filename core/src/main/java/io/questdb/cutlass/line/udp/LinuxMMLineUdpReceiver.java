@@ -25,12 +25,51 @@
 package io.questdb.cutlass.line.udp;
 
 import io.questdb.cairo.CairoEngine;
+import io.questdb.log.Log;
+import io.questdb.log.LogFactory;
+import io.questdb.mp.Job;
+import io.questdb.mp.MPSequence;
+import io.questdb.mp.RingQueue;
+import io.questdb.mp.SCSequence;
 import io.questdb.mp.WorkerPool;
 import io.questdb.network.Net;
+import io.questdb.network.NetworkError;
+import io.questdb.network.NetworkFacade;
+import io.questdb.std.MemoryTag;
+import io.questdb.std.Misc;
+import io.questdb.std.Numbers;
+import io.questdb.std.ObjList;
+import io.questdb.std.Os;
+import io.questdb.std.Unsafe;
 
+import java.io.Closeable;
+
+/**
+ * Receives datagrams in batches via recvmmsg(). When UDP GRO is enabled the kernel coalesces
+ * datagrams of the same flow into a single buffer, which is split back into the original
+ * datagrams by the native code.
+ * <p>
+ * With more than one shard, additional SO_REUSEPORT sockets are bound to the same port and
+ * read by dedicated workers. Shards only receive; the batches they fill are handed over to
+ * the single parser via a queue, because the parser holds table writers for its lifetime.
+ */
 public class LinuxMMLineUdpReceiver extends AbstractLineProtoUdpReceiver {
+    private static final Log LOG = LogFactory.getLog(LinuxMMLineUdpReceiver.class);
+    // GRO coalesces up to 64KB worth of datagrams, smaller buffers would truncate them
+    private static final int GRO_MIN_BUFFER_SIZE = 64 * 1024;
+    // batches read from primary socket per run, so that busy primary does not starve shards and commits
+    private static final int PRIMARY_BATCH_LIMIT = 16;
     private final int msgCount;
-    private long msgVec;
+    private final int msgBufferSize;
+    private final int segCapacity;
+    private final boolean groEnabled;
+    private final int rcvBufMaxSize;
+    private final LineUdpMetrics metrics;
+    private final ObjList<Shard> shards = new ObjList<>();
+    private final Shard primary;
+    private final RingQueue<Batch> queue;
+    private final MPSequence pubSeq;
+    private final SCSequence subSeq;
 
     public LinuxMMLineUdpReceiver(
             LineUdpReceiverConfiguration configuration,
@@ -39,46 +78,254 @@ public class LinuxMMLineUdpReceiver extends AbstractLineProtoUdpReceiver {
     ) {
         super(configuration, engine, workerPool);
         this.msgCount = configuration.getMsgCount();
-        msgVec = nf.msgHeaders(configuration.getMsgBufferSize(), msgCount);
+        this.msgBufferSize = configuration.getMsgBufferSize();
+        this.rcvBufMaxSize = configuration.getReceiveBufferMaxSize();
+        this.metrics = engine.getMetrics().lineUdp();
+
+        if (configuration.isGroEnabled() && msgBufferSize < GRO_MIN_BUFFER_SIZE) {
+            LOG.advisory().$("UDP GRO is disabled, message buffer is too small [msgBufferSize=").$(msgBufferSize)
+                    .$(", required=").$(GRO_MIN_BUFFER_SIZE).I$();
+            this.groEnabled = false;
+        } else {
+            this.groEnabled = configuration.isGroEnabled();
+        }
+        this.segCapacity = groEnabled ? msgCount * Net.MAX_GRO_SEGMENTS : msgCount;
+
+        int shardCount = 1;
+        if (configuration.getShardCount() > 1) {
+            if (configuration.isUnicast() && !configuration.ownThread() && workerPool != null) {
+                shardCount = Math.min(configuration.getShardCount(), workerPool.getWorkerCount());
+            } else {
+                // multicast group is joined by a single socket and own thread cannot run shard jobs
+                LOG.advisory().$("UDP receiver shards are disabled, they require unicast and shared worker pool [shardCount=")
+                        .$(configuration.getShardCount())
+                        .$(", unicast=").$(configuration.isUnicast())
+                        .$(", ownThread=").$(configuration.ownThread())
+                        .I$();
+            }
+        }
+
+        try {
+            this.primary = new Shard(fd, false, configuration);
+            if (shardCount > 1) {
+                final int cycle = Numbers.ceilPow2(shardCount);
+                this.queue = new RingQueue<>(() -> new Batch(nf, msgBufferSize, msgCount, segCapacity), cycle);
+                this.pubSeq = new MPSequence(cycle);
+                this.subSeq = new SCSequence();
+                pubSeq.then(subSeq).then(pubSeq);
+                for (int i = 1; i < shardCount; i++) {
+                    final Shard shard = new Shard(openShardSocket(configuration), true, configuration);
+                    shards.add(shard);
+                    workerPool.assign(i, (Job) shard);
+                }
+                LOG.info().$("receiving with shards [count=").$(shardCount).I$();
+            } else {
+                this.queue = null;
+                this.pubSeq = null;
+                this.subSeq = null;
+            }
+        } catch (Throwable e) {
+            close();
+            throw e;
+        }
         start();
     }
 
     @Override
     public void close() {
         super.close();
-        if (msgVec != 0) {
-            nf.freeMsgHeaders(msgVec);
-            msgVec = 0;
-        }
+        // fields are still null when super constructor fails and calls close()
+        Misc.freeObjList(shards);
+        Misc.free(primary);
+        Misc.free(queue);
     }
 
     @Override
     protected boolean runSerially() {
         boolean ran = false;
-        int count;
-        while ((count = nf.recvmmsg(fd, msgVec, msgCount)) > 0) {
-            long p = msgVec;
-            for (int i = 0; i < count; i++) {
-                long buf = nf.getMMsgBuf(p);
-                lexer.parse(buf, buf + nf.getMMsgBufLen(p));
-                lexer.parseLast();
-                p += Net.MMSGHDR_SIZE;
+        for (int i = 0; i < PRIMARY_BATCH_LIMIT && primary.receive() > 0; i++) {
+            parse(primary.batch);
+            ran = true;
+        }
+
+        if (queue != null) {
+            long cursor;
+            while ((cursor = subSeq.next()) > -1) {
+                parse(queue.get(cursor));
+                subSeq.done(cursor);
+                ran = true;
+            }
+        }
+        parser.commitAll(commitMode);
+        return ran;
+    }
+
+    private long openShardSocket(LineUdpReceiverConfiguration configuration) {
+        final long fd = nf.socketUdp();
+        if (fd < 0) {
+            throw NetworkError.instance(nf.errno(), "Cannot open UDP socket");
+        }
+        if (nf.setReusePort(fd) != 0 || !nf.bindUdp(fd, configuration.getBindIPv4Address(), configuration.getPort())) {
+            final int errno = nf.errno();
+            nf.close(fd, LOG);
+            throw NetworkError.instance(errno).couldNotBindSocket("udp-line-server", configuration.getBindIPv4Address(), configuration.getPort());
+        }
+        if (configuration.getReceiveBufferSize() != -1 && nf.setRcvBuf(fd, configuration.getReceiveBufferSize()) != 0) {
+            LOG.error().$("could not set receive buffer size [fd=").$(fd)
+                    .$(", size=").$(configuration.getReceiveBufferSize())
+                    .$(", errno=").$(nf.errno())
+                    .I$();
+        }
+        return fd;
+    }
+
+    private void parse(Batch batch) {
+        long p = batch.segVec;
+        for (int i = 0, n = batch.segCount; i < n; i++) {
+            final long lo = Unsafe.getUnsafe().getLong(p);
+            lexer.parse(lo, lo + Unsafe.getUnsafe().getLong(p + 8));
+            lexer.parseLast();
+            p += 16;
+        }
+
+        totalCount += batch.segCount;
+        metrics.addDatagrams(batch.segCount);
+        batch.segCount = 0;
+
+        if (totalCount > commitRate) {
+            totalCount = 0;
+            parser.commitAll(commitMode);
+        }
+    }
+
+    private static class Batch implements Closeable {
+        private final NetworkFacade nf;
+        private final long segVecSize;
+        private long msgVec;
+        private long segVec;
+        // number of (address, length) pairs in segVec
+        private int segCount;
+
+        private Batch(NetworkFacade nf, int msgBufferSize, int msgCount, int segCapacity) {
+            this.nf = nf;
+            this.msgVec = nf.msgHeaders(msgBufferSize, msgCount);
+            this.segVecSize = segCapacity * 16L;
+            this.segVec = Unsafe.malloc(segVecSize, MemoryTag.NATIVE_DEFAULT);
+        }
+
+        @Override
+        public void close() {
+            if (msgVec != 0) {
+                nf.freeMsgHeaders(msgVec);
+                msgVec = 0;
             }
+            if (segVec != 0) {
+                Unsafe.free(segVec, segVecSize, MemoryTag.NATIVE_DEFAULT);
+                segVec = 0;
+            }
+        }
 
-            totalCount += count;
+        private void swap(Batch that) {
+            final long msgVec = this.msgVec;
+            final long segVec = this.segVec;
+            final int segCount = this.segCount;
+            this.msgVec = that.msgVec;
+            this.segVec = that.segVec;
+            this.segCount = that.segCount;
+            that.msgVec = msgVec;
+            that.segVec = segVec;
+            that.segCount = segCount;
+        }
+    }
 
-            if (totalCount > commitRate) {
-                totalCount = 0;
-                parser.commitAll(commitMode);
+    private class Shard implements Job, Closeable {
+        private final Batch batch;
+        private final boolean ownsFd;
+        private long fd;
+        private long dropCount;
+        private int rcvBufSize;
+
+        private Shard(long fd, boolean ownsFd, LineUdpReceiverConfiguration configuration) {
+            this.fd = fd;
+            this.ownsFd = ownsFd;
+            this.batch = new Batch(nf, msgBufferSize, msgCount, segCapacity);
+            if (groEnabled && nf.setUdpGro(fd, true) != 0) {
+                LOG.error().$("could not enable UDP GRO [fd=").$(fd).$(", errno=").$(nf.errno()).I$();
+            }
+            if (nf.setRxqOverflow(fd, true) != 0) {
+                LOG.error().$("could not enable drop counter [fd=").$(fd).$(", errno=").$(nf.errno()).I$();
             }
+            // Linux reports double of the requested size to account for bookkeeping overhead
+            this.rcvBufSize = configuration.getReceiveBufferSize() != -1 ? configuration.getReceiveBufferSize() : nf.getRcvBuf(fd) / 2;
+        }
 
-            if (ran) {
-                continue;
+        @Override
+        public void close() {
+            Misc.free(batch);
+            if (ownsFd && fd > -1) {
+                nf.close(fd, LOG);
+                fd = -1;
             }
+        }
 
-            ran = true;
+        @Override
+        public boolean run(int workerId) {
+            if (batch.segCount == 0 && receive() == 0) {
+                return false;
+            }
+
+            long cursor;
+            while ((cursor = pubSeq.next()) == -2) {
+                Os.pause();
+            }
+
+            if (cursor < 0) {
+                // parser is behind, keep the batch and try again later
+                return true;
+            }
+            queue.get(cursor).swap(batch);
+            pubSeq.done(cursor);
+            return true;
+        }
+
+        private void growReceiveBuffer() {
+            if (rcvBufMaxSize <= 0 || rcvBufSize >= rcvBufMaxSize) {
+                return;
+            }
+            final int size = (int) Math.min(Math.max(rcvBufSize, 64 * 1024) * 2L, rcvBufMaxSize);
+            if (nf.setRcvBuf(fd, size) != 0) {
+                LOG.error().$("could not grow receive buffer [fd=").$(fd).$(", size=").$(size).$(", errno=").$(nf.errno()).I$();
+                rcvBufSize = rcvBufMaxSize;
+                return;
+            }
+
+            final int actual = nf.getRcvBuf(fd) / 2;
+            if (actual < size) {
+                LOG.advisory().$("receive buffer is capped by OS, consider raising net.core.rmem_max [fd=").$(fd)
+                        .$(", requested=").$(size)
+                        .$(", actual=").$(actual)
+                        .I$();
+                rcvBufSize = rcvBufMaxSize;
+            } else {
+                LOG.info().$("receive buffer grown [fd=").$(fd).$(", size=").$(size).I$();
+                rcvBufSize = size;
+            }
+        }
+
+        private int receive() {
+            final int n = nf.recvmmsgSegments(fd, batch.msgVec, msgCount, batch.segVec, segCapacity);
+            batch.segCount = Math.max(n, 0);
+            if (n > 0) {
+                // counter is cumulative for the socket, a batch that has not seen it recently holds a stale value
+                final long drops = nf.getMMsgDropCount(batch.msgVec, msgCount);
+                if (drops > dropCount) {
+                    metrics.addDrops(drops - dropCount);
+                    LOG.info().$("datagrams dropped [fd=").$(fd).$(", count=").$(drops - dropCount).I$();
+                    dropCount = drops;
+                    growReceiveBuffer();
+                }
+            }
+            return batch.segCount;
         }
-        parser.commitAll(commitMode);
-        return ran;
     }
 }
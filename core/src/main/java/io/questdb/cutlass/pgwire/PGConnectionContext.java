@@ -173,6 +173,8 @@ public class PGConnectionContext implements IOContext, Mutable, WriterSource {
     private IODispatcher<PGConnectionContext> dispatcher;
     private Rnd rnd;
     private long rowCount;
+    // upper bound of DataRow size when all columns of the cursor are sent as fixed width binary values, -1 otherwise
+    private int fixedBinaryRowSize = -1;
     private boolean completed = true;
     private boolean isEmptyQuery;
     private final PGResumeProcessor resumeCommandCompleteRef = this::resumeCommandComplete;
@@ -740,7 +742,112 @@ public class PGConnectionContext implements IOContext, Mutable, WriterSource {
         }
     }
 
+    private void appendFixedBinaryRecord(Record record, int columnCount) {
+        // single capacity check for the whole row, cells are then written without bounds checks
+        responseAsciiSink.ensureCapacity(fixedBinaryRowSize);
+        final long start = sendBufferPtr;
+        Unsafe.getUnsafe().putByte(start, MESSAGE_TYPE_DATA_ROW);
+        putShort(start + Byte.BYTES + Integer.BYTES, (short) columnCount);
+        long p = start + Byte.BYTES + Integer.BYTES + Short.BYTES;
+        for (int i = 0; i < columnCount; i++) {
+            switch (ColumnType.tagOf(activeSelectColumnTypes.getQuick(2 * i))) {
+                case ColumnType.INT:
+                    final int intValue = record.getInt(i);
+                    if (intValue != Numbers.INT_NaN) {
+                        putInt(p, Integer.BYTES);
+                        putInt(p + Integer.BYTES, intValue);
+                        p += Integer.BYTES + Integer.BYTES;
+                    } else {
+                        Unsafe.getUnsafe().putInt(p, INT_NULL_X);
+                        p += Integer.BYTES;
+                    }
+                    break;
+                case ColumnType.LONG:
+                    final long longValue = record.getLong(i);
+                    if (longValue != Numbers.LONG_NaN) {
+                        putInt(p, Long.BYTES);
+                        putLong(p + Integer.BYTES, longValue);
+                        p += Integer.BYTES + Long.BYTES;
+                    } else {
+                        Unsafe.getUnsafe().putInt(p, INT_NULL_X);
+                        p += Integer.BYTES;
+                    }
+                    break;
+                case ColumnType.DOUBLE:
+                    final double doubleValue = record.getDouble(i);
+                    if (doubleValue == doubleValue) {
+                        putInt(p, Double.BYTES);
+                        putLong(p + Integer.BYTES, Double.doubleToLongBits(doubleValue));
+                        p += Integer.BYTES + Double.BYTES;
+                    } else {
+                        Unsafe.getUnsafe().putInt(p, INT_NULL_X);
+                        p += Integer.BYTES;
+                    }
+                    break;
+                case ColumnType.FLOAT:
+                    final float floatValue = record.getFloat(i);
+                    if (floatValue == floatValue) {
+                        putInt(p, Float.BYTES);
+                        putInt(p + Integer.BYTES, Float.floatToIntBits(floatValue));
+                        p += Integer.BYTES + Float.BYTES;
+                    } else {
+                        Unsafe.getUnsafe().putInt(p, INT_NULL_X);
+                        p += Integer.BYTES;
+                    }
+                    break;
+                case ColumnType.SHORT:
+                    putInt(p, Short.BYTES);
+                    putShort(p + Integer.BYTES, record.getShort(i));
+                    p += Integer.BYTES + Short.BYTES;
+                    break;
+                case ColumnType.BYTE:
+                    // byte is sent as int2
+                    putInt(p, Short.BYTES);
+                    putShort(p + Integer.BYTES, record.getByte(i));
+                    p += Integer.BYTES + Short.BYTES;
+                    break;
+                case ColumnType.BOOLEAN:
+                    putInt(p, Byte.BYTES);
+                    Unsafe.getUnsafe().putByte(p + Integer.BYTES, record.getBool(i) ? (byte) 1 : (byte) 0);
+                    p += Integer.BYTES + Byte.BYTES;
+                    break;
+                case ColumnType.DATE:
+                    final long dateValue = record.getLong(i);
+                    if (dateValue != Numbers.LONG_NaN) {
+                        putInt(p, Long.BYTES);
+                        // PG epoch starts at 2000 rather than 1970
+                        putLong(p + Integer.BYTES, dateValue * 1000 - Numbers.JULIAN_EPOCH_OFFSET_USEC);
+                        p += Integer.BYTES + Long.BYTES;
+                    } else {
+                        Unsafe.getUnsafe().putInt(p, INT_NULL_X);
+                        p += Integer.BYTES;
+                    }
+                    break;
+                default:
+                    // TIMESTAMP, the only remaining type getFixedBinaryRowSize() lets through
+                    final long timestampValue = record.getLong(i);
+                    if (timestampValue != Numbers.LONG_NaN) {
+                        putInt(p, Long.BYTES);
+                        putLong(p + Integer.BYTES, timestampValue - Numbers.JULIAN_EPOCH_OFFSET_USEC);
+                        p += Integer.BYTES + Long.BYTES;
+                    } else {
+                        Unsafe.getUnsafe().putInt(p, INT_NULL_X);
+                        p += Integer.BYTES;
+                    }
+                    break;
+            }
+        }
+        // message length includes itself, but not the message type
+        putInt(start + Byte.BYTES, (int) (p - start - Byte.BYTES));
+        sendBufferPtr = p;
+        rowCount += 1;
+    }
+
     private void appendRecord(Record record, int columnCount) throws SqlException {
+        if (fixedBinaryRowSize > -1) {
+            appendFixedBinaryRecord(record, columnCount);
+            return;
+        }
         responseAsciiSink.put(MESSAGE_TYPE_DATA_ROW); // data
         final long offset = responseAsciiSink.skip();
         responseAsciiSink.putNetworkShort((short) columnCount);
@@ -1293,6 +1400,36 @@ public class PGConnectionContext implements IOContext, Mutable, WriterSource {
         }
     }
 
+    private int getFixedBinaryRowSize(int columnCount) {
+        int size = Byte.BYTES + Integer.BYTES + Short.BYTES;
+        for (int i = 0; i < columnCount; i++) {
+            final int type = activeSelectColumnTypes.getQuick(2 * i);
+            switch (toColumnBinaryType(getColumnBinaryFlag(type), ColumnType.tagOf(type))) {
+                case BINARY_TYPE_BOOLEAN:
+                    size += Integer.BYTES + Byte.BYTES;
+                    break;
+                case BINARY_TYPE_BYTE:
+                case BINARY_TYPE_SHORT:
+                    size += Integer.BYTES + Short.BYTES;
+                    break;
+                case BINARY_TYPE_INT:
+                case BINARY_TYPE_FLOAT:
+                    size += Integer.BYTES + Integer.BYTES;
+                    break;
+                case BINARY_TYPE_LONG:
+                case BINARY_TYPE_DOUBLE:
+                case BINARY_TYPE_DATE:
+                case BINARY_TYPE_TIMESTAMP:
+                    size += Integer.BYTES + Long.BYTES;
+                    break;
+                default:
+                    // text format or variable length value
+                    return -1;
+            }
+        }
+        return size;
+    }
+
     @Nullable
     private CharSequence getPortalName(long lo, long hi) throws BadProtocolException {
         if (hi - lo > 0) {
@@ -2254,6 +2391,7 @@ public class PGConnectionContext implements IOContext, Mutable, WriterSource {
         final long cursorRowCount = currentCursor.size();
         this.maxRows = maxRows > 0 ? Long.min(maxRows, cursorRowCount) : Long.MAX_VALUE;
         this.resumeProcessor = cursorResumeProcessor;
+        this.fixedBinaryRowSize = getFixedBinaryRowSize(columnCount);
         sendCursor0(record, columnCount, commandCompleteResumeProcessor);
     }
 
@@ -63,6 +63,9 @@ public class TextLexer implements Closeable, Mutable {
     private long fieldLo;
     private long fieldHi;
     private boolean skipLinesWithExtraValues;
+    // one bit per byte of the buffer being parsed, set for bytes that have to be handled one by one
+    private long structuralBitmap;
+    private long structuralBitmapSize;
 
     public TextLexer(TextConfiguration textConfiguration, TypeManager typeManager) {
         this.metadataDetector = new TextMetadataDetector(typeManager, textConfiguration);
@@ -102,6 +105,11 @@ public class TextLexer implements Closeable, Mutable {
             Unsafe.free(lineRollBufPtr, lineRollBufLen, MemoryTag.NATIVE_DEFAULT);
             lineRollBufPtr = 0;
         }
+        if (structuralBitmap != 0) {
+            Unsafe.free(structuralBitmap, structuralBitmapSize, MemoryTag.NATIVE_DEFAULT);
+            structuralBitmap = 0;
+            structuralBitmapSize = 0;
+        }
         metadataDetector.close();
     }
 
@@ -309,11 +317,35 @@ public class TextLexer implements Closeable, Mutable {
         }
     }
 
+    private long nextStructural(long ptr, long lo, long hi) {
+        final long offset = ptr - lo;
+        long w = offset >>> 6;
+        long bits = Unsafe.getUnsafe().getLong(structuralBitmap + (w << 3)) & (-1L << (offset & 63));
+        final long wHi = (hi - lo + 63) >>> 6;
+        while (bits == 0) {
+            if (++w == wHi) {
+                return hi;
+            }
+            bits = Unsafe.getUnsafe().getLong(structuralBitmap + (w << 3));
+        }
+        return lo + (w << 6) + Long.numberOfTrailingZeros(bits);
+    }
+
     private void parse(long lo, long hi) {
         long ptr = lo;
+        scanStructural(lo, hi);
 
         try {
             while (ptr < hi) {
+                final long next = nextStructural(ptr, lo, hi);
+                if (next > ptr) {
+                    skipFieldBytes(lo, ptr, next);
+                    ptr = next;
+                    if (ptr == hi) {
+                        break;
+                    }
+                }
+
                 final byte c = Unsafe.getUnsafe().getByte(ptr++);
 
                 if (rollBufferUnusable) {
@@ -368,6 +400,15 @@ public class TextLexer implements Closeable, Mutable {
         }
     }
 
+    private void putToRollBuf(long lo, long len) {
+        final long required = lineRollBufCur - lineRollBufPtr + len;
+        if (required > lineRollBufLen && !growRollBuf((int) Math.min(required, Integer.MAX_VALUE), true)) {
+            return;
+        }
+        Vect.memcpy(lineRollBufCur, lo, len);
+        lineRollBufCur += len;
+    }
+
     private void rollLine(long lo, long hi) {
         // lastLineStart is an offset from 'lo'
         // 'lo' is the address of incoming buffer
@@ -385,6 +426,21 @@ public class TextLexer implements Closeable, Mutable {
         this.metadataDetector.setTableName(tableName);
     }
 
+    private void scanStructural(long lo, long hi) {
+        final long size = ((hi - lo + 63) >>> 6) << 3;
+        if (size > structuralBitmapSize) {
+            final long newSize = Numbers.ceilPow2(size);
+            if (structuralBitmap != 0) {
+                Unsafe.free(structuralBitmap, structuralBitmapSize, MemoryTag.NATIVE_DEFAULT);
+            }
+            structuralBitmap = Unsafe.malloc(newSize, MemoryTag.NATIVE_DEFAULT);
+            structuralBitmapSize = newSize;
+        }
+        if (hi > lo) {
+            TextLexerNative.structuralScan(lo, hi - lo, columnDelimiter, structuralBitmap);
+        }
+    }
+
     private void shift(long d) {
         for (int i = 0; i < fieldIndex; i++) {
             fields.getQuick(i).shl(d);
@@ -396,6 +452,29 @@ public class TextLexer implements Closeable, Mutable {
         }
     }
 
+    // Same as running bytes between ptr and next through the main loop one at a time.
+    // None of them is a delimiter, quote or line end, so they only extend current field.
+    private void skipFieldBytes(long lo, long ptr, long next) {
+        if (rollBufferUnusable) {
+            return;
+        }
+
+        if (useLineRollBuf) {
+            putToRollBuf(ptr, next - ptr);
+            if (rollBufferUnusable) {
+                return;
+            }
+        }
+
+        this.fieldHi += next - ptr;
+
+        if (delayedOutQuote) {
+            inQuote = delayedOutQuote = false;
+        }
+
+        checkEol(lo);
+    }
+
     private void stashField(int fieldIndex) {
         if (lineCount == 0 && fieldIndex >= fields.size()) {
             addField();
@@ -0,0 +1,41 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.cutlass.text;
+
+public class TextLexerNative {
+
+    /**
+     * Computes bitmap of bytes {@link TextLexer} has to handle one by one: column delimiter,
+     * quote and line ends. Everything in between is field content and can be skipped over in bulk.
+     * Each 64 bytes of input produce one bitmap word, bit n of the word is set when byte n
+     * of the block is structural. Bits past the scanned length in the last word are cleared.
+     *
+     * @param lo        address of the first byte to scan, maps to bit 0 of the first word
+     * @param len       number of bytes to scan
+     * @param delimiter column delimiter
+     * @param bitmap    address of the first bitmap word to write
+     */
+    public static native void structuralScan(long lo, long len, byte delimiter, long bitmap);
+}
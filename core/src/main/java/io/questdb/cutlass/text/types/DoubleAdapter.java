@@ -58,6 +58,14 @@ public final class DoubleAdapter extends AbstractTypeAdapter {
 
     @Override
     public void write(TableWriter.Row row, int column, DirectByteCharSequence value) throws Exception {
-        row.putDouble(column, SqlKeywords.isNullKeyword(value) ? Double.NaN : Numbers.parseDouble(value));
+        row.putDouble(column, SqlKeywords.isNullKeyword(value) ? Double.NaN : parseDouble(value));
+    }
+
+    private static double parseDouble(DirectByteCharSequence value) throws NumericException {
+        final double val = Numbers.parseDecimalDouble(value.getLo(), value.getHi());
+        if (!Double.isNaN(val)) {
+            return val;
+        }
+        return Numbers.parseDouble(value);
     }
 }
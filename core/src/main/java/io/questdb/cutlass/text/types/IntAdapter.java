@@ -67,6 +67,10 @@ public final class IntAdapter extends AbstractTypeAdapter implements TimestampCo
     }
 
     private int parseInt(DirectByteCharSequence value) throws NumericException {
+        final long val = Numbers.parseDecimalLong(value.getLo(), value.getHi());
+        if (val > Numbers.INT_NaN && val <= Integer.MAX_VALUE) {
+            return (int) val;
+        }
         return Numbers.parseInt(value);
     }
 }
@@ -39,6 +39,10 @@ public final class LongAdapter extends AbstractTypeAdapter implements TimestampC
     }
 
     public long getLong(DirectByteCharSequence value) throws Exception {
+        final long val = Numbers.parseDecimalLong(value.getLo(), value.getHi());
+        if (val != Numbers.LONG_NaN) {
+            return val;
+        }
         return Numbers.parseLong(value);
     }
 
@@ -1932,44 +1932,47 @@ public class SqlCompiler implements Closeable {
 
     private void copyTable(SqlExecutionContext executionContext, CopyModel model) throws SqlException {
         try {
-            int len = configuration.getSqlCopyBufferSize();
-            long buf = Unsafe.malloc(len, MemoryTag.NATIVE_DEFAULT);
+            final CharSequence name = GenericLexer.assertNoDots(GenericLexer.unquote(model.getFileName().token), model.getFileName().position);
+            path.of(configuration.getInputRoot()).concat(name).$();
+            long fd = ff.openRO(path);
+            if (fd == -1) {
+                throw SqlException.$(model.getFileName().position, "could not open file [errno=").put(Os.errno()).put(", path=").put(path).put(']');
+            }
             try {
-                final CharSequence name = GenericLexer.assertNoDots(GenericLexer.unquote(model.getFileName().token), model.getFileName().position);
-                path.of(configuration.getInputRoot()).concat(name).$();
-                long fd = ff.openRO(path);
-                if (fd == -1) {
-                    throw SqlException.$(model.getFileName().position, "could not open file [errno=").put(Os.errno()).put(", path=").put(path).put(']');
-                }
-                try {
-                    long fileLen = ff.length(fd);
-                    long n = ff.read(fd, buf, len, 0);
-                    if (n > 0) {
-                        textLoader.setForceHeaders(model.isHeader());
-                        textLoader.setSkipRowsWithExtraValues(false);
-                        textLoader.parse(buf, buf + n, executionContext.getCairoSecurityContext());
-                        textLoader.setState(TextLoader.LOAD_DATA);
-                        int read;
-                        while (n < fileLen) {
-                            read = (int) ff.read(fd, buf, len, n);
-                            if (read < 1) {
-                                throw SqlException.$(model.getFileName().position, "could not read file [errno=").put(ff.errno()).put(']');
-                            }
-                            textLoader.parse(buf, buf + read, executionContext.getCairoSecurityContext());
-                            n += read;
+                final long fileLen = ff.length(fd);
+                // file is parsed straight from page cache, mapped in windows of copy buffer size;
+                // every byte of the window is parsed right away, so it is populated on map
+                final long windowSize = Files.ceilPageSize(configuration.getSqlCopyBufferSize());
+                if (fileLen > 0) {
+                    textLoader.setForceHeaders(model.isHeader());
+                    textLoader.setSkipRowsWithExtraValues(false);
+                    long offset = 0;
+                    while (offset < fileLen) {
+                        final long size = Math.min(windowSize, fileLen - offset);
+                        final long address = ff.mmap(fd, size, offset, Files.MAP_RO | Files.MAP_POPULATE, MemoryTag.MMAP_DEFAULT);
+                        if (address == FilesFacade.MAP_FAILED) {
+                            throw SqlException.$(model.getFileName().position, "could not read file [errno=").put(ff.errno()).put(']');
                         }
-                        textLoader.wrapUp();
+                        try {
+                            ff.madvise(address, size, Files.POSIX_MADV_SEQUENTIAL);
+                            textLoader.parse(address, address + size, executionContext.getCairoSecurityContext());
+                        } finally {
+                            ff.munmap(address, size, MemoryTag.MMAP_DEFAULT);
+                        }
+                        if (offset == 0) {
+                            textLoader.setState(TextLoader.LOAD_DATA);
+                        }
+                        offset += size;
                     }
-                } finally {
-                    ff.close(fd);
+                    textLoader.wrapUp();
                 }
             } finally {
-                textLoader.clear();
-                Unsafe.free(buf, len, MemoryTag.NATIVE_DEFAULT);
+                ff.close(fd);
             }
         } catch (TextException e) {
             // we do not expect JSON exception here
         } finally {
+            textLoader.clear();
             LOG.info().$("copied").$();
         }
     }
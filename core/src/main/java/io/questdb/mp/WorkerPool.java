@@ -113,6 +113,14 @@ public class WorkerPool {
         freeOnHalt.add(closeable);
     }
 
+    /**
+     * @return CPU the worker is pinned to or -1 when the worker is not pinned
+     */
+    public int getWorkerAffinity(int worker) {
+        assert worker > -1 && worker < workerCount;
+        return workerAffinity[worker];
+    }
+
     public int getWorkerCount() {
         return workerCount;
     }
@@ -66,6 +66,9 @@ public abstract class AbstractIODispatcher<C extends IOContext> extends Synchron
     private final long queuedConnectionTimeoutMs;
     private long closeListenFdEpochMs;
     private final boolean peerNoLinger;
+    private final int busyPollUsec;
+    private final int listenerCpu;
+    private final boolean reusePort;
 
     public AbstractIODispatcher(
             IODispatcherConfiguration configuration,
@@ -99,6 +102,9 @@ public abstract class AbstractIODispatcher<C extends IOContext> extends Synchron
         this.sndBufSize = configuration.getSndBufSize();
         this.rcvBufSize = configuration.getRcvBufSize();
         this.peerNoLinger = configuration.getPeerNoLinger();
+        this.busyPollUsec = configuration.getBusyPollUsec();
+        this.listenerCpu = configuration.getListenerCpu();
+        this.reusePort = configuration.isReusePortEnabled();
 
         createListenFd();
         listening = true;
@@ -107,6 +113,12 @@ public abstract class AbstractIODispatcher<C extends IOContext> extends Synchron
     private void createListenFd() throws NetworkError {
         this.serverFd = nf.socketTcp(false);
         final int backlog = configuration.getListenBacklog();
+        if (reusePort && nf.setReusePort(this.serverFd) < 0) {
+            LOG.error().$("could not set SO_REUSEPORT [fd=").$(serverFd).$(", errno=").$(nf.errno()).I$();
+        }
+        if (listenerCpu > -1 && nf.setIncomingCpu(this.serverFd, listenerCpu) < 0) {
+            LOG.info().$("could not pin listener to CPU [fd=").$(serverFd).$(", cpu=").$(listenerCpu).$(", errno=").$(nf.errno()).I$();
+        }
         if (nf.bindTcp(this.serverFd, configuration.getBindIPv4Address(), configuration.getBindPort())) {
             nf.listen(this.serverFd, backlog);
         } else {
@@ -118,6 +130,7 @@ public abstract class AbstractIODispatcher<C extends IOContext> extends Synchron
         LOG.advisory().$("listening on ").$ip(configuration.getBindIPv4Address()).$(':').$(configuration.getBindPort())
                 .$(" [fd=").$(serverFd)
                 .$(" backlog=").$(backlog)
+                .$(" cpu=").$(listenerCpu)
                 .I$();
     }
 
@@ -229,6 +242,10 @@ public abstract class AbstractIODispatcher<C extends IOContext> extends Synchron
                 nf.setRcvBuf(fd, rcvBufSize);
             }
 
+            if (busyPollUsec > 0 && nf.setBusyPoll(fd, busyPollUsec) < 0) {
+                LOG.info().$("could not enable busy poll [fd=").$(fd).$(", errno=").$(nf.errno()).I$();
+            }
+
             LOG.info().$("connected [ip=").$ip(nf.getPeerIP(fd)).$(", fd=").$(fd).$(']').$();
             tlConCount = connectionCount.incrementAndGet();
             addPending(fd, timestamp);
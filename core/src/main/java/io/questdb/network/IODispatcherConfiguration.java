@@ -58,6 +58,13 @@ public interface IODispatcherConfiguration {
 
     int getInitialBias();
 
+    /**
+     * @return CPU the listening socket is pinned to with SO_INCOMING_CPU, -1 to leave it unpinned
+     */
+    default int getListenerCpu() {
+        return -1;
+    }
+
     default int getInterestQueueCapacity() {
         return Numbers.ceilPow2(getLimit());
     }
@@ -77,6 +84,13 @@ public interface IODispatcherConfiguration {
         return getLimit();
     }
 
+    /**
+     * @return microseconds to busy poll device queue on reads of accepted connections, 0 to disable
+     */
+    default int getBusyPollUsec() {
+        return 0;
+    }
+
     NetworkFacade getNetworkFacade();
 
     default boolean getPeerNoLinger() {
@@ -89,5 +103,21 @@ public interface IODispatcherConfiguration {
 
     int getSndBufSize();
 
+    /**
+     * @return true to wait for socket readiness via io_uring instead of epoll on Linux,
+     * ignored when kernel does not support io_uring
+     */
+    default boolean isIOURingEnabled() {
+        return false;
+    }
+
+    /**
+     * @return true to bind listening socket with SO_REUSEPORT, so that several dispatchers
+     * can share the port and kernel balances connections between them
+     */
+    default boolean isReusePortEnabled() {
+        return false;
+    }
+
     long getQueueTimeout();
 }
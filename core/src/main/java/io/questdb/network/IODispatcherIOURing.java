@@ -0,0 +1,248 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.network;
+
+import io.questdb.std.IOURing;
+
+/**
+ * Linux dispatcher that waits for socket readiness via io_uring rather than epoll. Polls
+ * are one-shot, like epoll registrations, but they are queued in user space and handed to
+ * the kernel in a single batch per dispatcher iteration instead of one epoll_ctl() call per
+ * connection. Completions are read from memory shared with the kernel, so an iteration
+ * that has nothing to submit does not enter the kernel at all.
+ * <p>
+ * Only readiness goes through the ring. Connections are accepted, read and written by the
+ * contexts with regular system calls, same as with epoll, since IOContext implementations
+ * own their buffers and perform I/O themselves.
+ * <p>
+ * Poll ids are issued by the ring in increasing order and a connection is armed once, when
+ * it is appended to the pending list, so pending rows are ordered by poll id and completions
+ * are matched to rows by binary search.
+ */
+public class IODispatcherIOURing<C extends IOContext> extends AbstractIODispatcher<C> {
+    private static final int M_ID = 2;
+    private static final int M_OPERATION = 3;
+    // number of submissions attempted to make room in full submission queue before giving up
+    private static final int SUBMIT_RETRY_LIMIT = 16;
+    private final IOURing ring;
+    private long listenerId = -1;
+    private int submitErrno = 0;
+
+    public IODispatcherIOURing(
+            IODispatcherConfiguration configuration,
+            IOContextFactory<C> ioContextFactory
+    ) {
+        super(configuration, ioContextFactory);
+        try {
+            this.ring = new IOURing(configuration.getEventCapacity());
+        } catch (Throwable e) {
+            super.close();
+            throw e;
+        }
+        try {
+            registerListenerFd();
+        } catch (Throwable e) {
+            close();
+            throw e;
+        }
+    }
+
+    @Override
+    public void close() {
+        super.close();
+        // polls that are still armed are cancelled when ring is closed
+        this.ring.close();
+        LOG.info().$("closed").$();
+    }
+
+    private boolean armPoll(int row, long fd, int operation) {
+        final long id = enqueuePollAdd(fd, operation == IOOperation.READ ? IOURing.POLLIN : IOURing.POLLOUT);
+        if (id == -1) {
+            LOG.error().$("could not arm poll, io_uring submission queue is full [fd=").$(fd).$(", errno=").$(submitErrno).I$();
+            return false;
+        }
+        // binary search in runSerially() relies on rows being ordered by poll id
+        assert row == pending.size() - 1 && (row == 0 || pending.get(row - 1, M_ID) < id);
+        pending.set(row, M_OPERATION, operation);
+        pending.set(row, M_ID, id);
+        return true;
+    }
+
+    private void disconnectUnarmed(int row) {
+        final C context = pending.get(row);
+        pending.deleteRow(row);
+        doDisconnect(context, DISCONNECT_SRC_QUEUE);
+    }
+
+    private long enqueuePollAdd(long fd, int events) {
+        for (int i = 0; i < SUBMIT_RETRY_LIMIT; i++) {
+            final long id = ring.enqueuePollAdd(fd, events);
+            if (id != -1) {
+                return id;
+            }
+            // submission queue is full, kernel may refuse to take entries while its
+            // completion queue is full too, which is why the number of attempts is bounded
+            submit();
+        }
+        return -1;
+    }
+
+    private boolean removePoll(long id) {
+        // socket does not close while poll holds a reference to it, so
+        // poll has to be removed before connection is disconnected
+        for (int i = 0; i < SUBMIT_RETRY_LIMIT; i++) {
+            if (ring.enqueuePollRemove(id) != -1) {
+                return true;
+            }
+            submit();
+        }
+        LOG.error().$("could not remove poll, io_uring submission queue is full [id=").$(id).$(", errno=").$(submitErrno).I$();
+        return false;
+    }
+
+    private void submit() {
+        final int rc = ring.submit();
+        if (rc < 0) {
+            submitErrno = -rc;
+            LOG.error().$("could not submit to io_uring [errno=").$(-rc).I$();
+        } else {
+            submitErrno = 0;
+        }
+    }
+
+    @Override
+    protected void pendingAdded(int index) {
+        final boolean armed = armPoll(
+                index,
+                pending.get(index, M_FD),
+                initialBias == IODispatcherConfiguration.BIAS_READ ? IOOperation.READ : IOOperation.WRITE
+        );
+        if (!armed) {
+            disconnectUnarmed(index);
+        }
+    }
+
+    private void processIdleConnections(long deadline) {
+        int count = 0;
+        for (int i = 0, n = pending.size(); i < n && pending.get(i, M_TIMESTAMP) < deadline; i++, count++) {
+            // socket stays open until ring is closed when its poll cannot be removed,
+            // connection is disconnected regardless so that dispatcher does not stall
+            removePoll(pending.get(i, M_ID));
+            doDisconnect(pending.get(i), DISCONNECT_SRC_IDLE);
+        }
+        pending.zapTop(count);
+    }
+
+    private boolean processRegistrations(long timestamp) {
+        long cursor;
+        boolean useful = false;
+        while ((cursor = interestSubSeq.next()) > -1) {
+            IOEvent<C> evt = interestQueue.get(cursor);
+            C context = evt.context;
+            int operation = evt.operation;
+            interestSubSeq.done(cursor);
+
+            final long fd = context.getFd();
+            int r = pending.addRow();
+            pending.set(r, M_TIMESTAMP, timestamp);
+            pending.set(r, M_FD, fd);
+            pending.set(r, context);
+            if (!armPoll(r, fd, operation)) {
+                disconnectUnarmed(r);
+                continue;
+            }
+            LOG.debug().$("registered [fd=").$(fd).$(", op=").$(operation).$(", id=").$(pending.get(r, M_ID)).$(']').$();
+            useful = true;
+        }
+        return useful;
+    }
+
+    @Override
+    protected boolean runSerially() {
+        boolean useful = false;
+
+        final long timestamp = clock.getTicks();
+        processDisconnects(timestamp);
+        while (ring.nextCqe()) {
+            final long id = ring.getCqeId();
+            if (id == listenerId) {
+                listenerId = -1;
+                final long res = ring.getCqeRes();
+                if (res < 0) {
+                    LOG.error().$("could not poll listener [serverFd=").$(serverFd).$(", errno=").$(-res).I$();
+                } else {
+                    accept(timestamp);
+                    // accept() unregisters listener when connection limit is reached
+                    if (isListening()) {
+                        registerListenerFd();
+                    }
+                }
+            } else {
+                // rows in pending are ordered by poll id
+                final int row = pending.binarySearch(id, M_ID);
+                if (row < 0) {
+                    // poll removal or removed poll
+                    continue;
+                }
+                // poll errors are discovered by the context when it performs the operation
+                publishOperation((int) pending.get(row, M_OPERATION), pending.get(row));
+                pending.deleteRow(row);
+            }
+            useful = true;
+        }
+
+        // process timed out connections
+        final long deadline = timestamp - idleConnectionTimeout;
+        if (pending.size() > 0 && pending.get(0, M_TIMESTAMP) < deadline) {
+            processIdleConnections(deadline);
+            useful = true;
+        }
+
+        useful |= processRegistrations(timestamp);
+        // single system call for all polls and removals of this iteration, if there are any
+        submit();
+        return useful;
+    }
+
+    @Override
+    protected void registerListenerFd() {
+        listenerId = enqueuePollAdd(serverFd, IOURing.POLLIN);
+        if (listenerId == -1) {
+            throw NetworkError.instance(submitErrno, "could not poll listener, io_uring submission queue is full");
+        }
+    }
+
+    @Override
+    protected void unregisterListenerFd() {
+        if (listenerId != -1) {
+            final long id = listenerId;
+            listenerId = -1;
+            if (!removePoll(id)) {
+                throw NetworkError.instance(submitErrno, "could not remove listener poll, io_uring submission queue is full");
+            }
+        }
+    }
+}
@@ -24,9 +24,14 @@
 
 package io.questdb.network;
 
+import io.questdb.cairo.CairoException;
+import io.questdb.log.Log;
+import io.questdb.log.LogFactory;
+import io.questdb.std.IOURing;
 import io.questdb.std.Os;
 
 public class IODispatchers {
+    private static final Log LOG = LogFactory.getLog(IODispatchers.class);
 
     private IODispatchers() {
     }
@@ -38,6 +43,15 @@ public class IODispatchers {
         switch (Os.type) {
             case Os.LINUX_AMD64:
             case Os.LINUX_ARM64:
+                if (configuration.isIOURingEnabled() && IOURing.isAvailable()) {
+                    try {
+                        return new IODispatcherIOURing<>(configuration, ioContextFactory);
+                    } catch (CairoException e) {
+                        // ring setup fails e.g. when RLIMIT_MEMLOCK is too low or seccomp policy forbids it
+                        LOG.advisory().$("could not create io_uring, falling back to epoll [errno=").$(e.getErrno())
+                                .$(", msg=").$(e.getFlyweightMessage()).I$();
+                    }
+                }
                 return new IODispatcherLinux<>(configuration, ioContextFactory);
             case Os.OSX_AMD64:
             case Os.OSX_ARM64:
@@ -41,6 +41,13 @@ public final class Net {
     public static final int EPEERDISCONNECT = -1;
     @SuppressWarnings("unused")
     public static final int EOTHERDISCONNECT = -2;
+    // file ended before requested number of bytes was sent
+    @SuppressWarnings("unused")
+    public static final int EEOF = -3;
+    // maximum number of buffers sendv() accepts
+    public static final int MAX_IOV = 16;
+    // max number of datagrams kernel coalesces into single message with UDP_GRO
+    public static final int MAX_GRO_SEGMENTS = 128;
     public static final int SHUT_WR = 1;
 
     private Net() {
@@ -115,6 +122,20 @@ public final class Net {
         return Unsafe.getUnsafe().getInt(msgPtr + MMSGHDR_BUFFER_LENGTH_OFFSET);
     }
 
+    /**
+     * @return number of datagrams kernel dropped on the socket because its receive buffer was full,
+     * as last reported by SO_RXQ_OVFL, counted from the socket creation
+     */
+    public static long getMMsgDropCount(long msgvec, int vlen) {
+        return Unsafe.getUnsafe().getLong(msgvec + vlen * MMSGHDR_SIZE);
+    }
+
+    /**
+     * @return CPU that processed the most recent packets of the socket, or -1 when
+     * the information is not available on this OS
+     */
+    public native static int getIncomingCpu(long fd);
+
     public native static int getPeerIP(long fd);
 
     public native static int getPeerPort(long fd);
@@ -174,10 +195,60 @@ public final class Net {
 
     public static native int recvmmsg(long fd, long msgvec, int vlen);
 
+    /**
+     * Receives batch of datagrams and splits messages coalesced by UDP_GRO back into
+     * original datagrams. Each message of the vector must be large enough to hold
+     * coalesced datagrams, i.e. 64KB, otherwise they are truncated.
+     *
+     * @param segvec      address of (address, length) long pairs, one per datagram
+     * @param segCapacity number of pairs segvec can hold, vlen * {@link #MAX_GRO_SEGMENTS} is always enough
+     * @return number of datagrams or -1 when there is nothing to receive or on error
+     */
+    public static native int recvmmsgSegments(long fd, long msgvec, int vlen, long segvec, int segCapacity);
+
     public static native int send(long fd, long ptr, int len);
 
+    /**
+     * Sends file content to the socket without copying it to user space.
+     *
+     * @param fd     file descriptor
+     * @param sockFd socket descriptor
+     * @param offset file offset to send from
+     * @param len    number of bytes to send, must not reach beyond end of file
+     * @return number of bytes sent, {@link #ERETRY} when socket is not ready to send, {@link #EEOF} when file
+     * ends at offset or {@link #EOTHERDISCONNECT}
+     */
+    public static native long sendFile(long fd, long sockFd, long offset, long len);
+
+    /**
+     * Gathers data from multiple buffers and sends it in a single system call.
+     *
+     * @param iov    address of (address, length) long pairs, one per buffer
+     * @param iovCnt number of buffers, up to {@link #MAX_IOV}
+     * @return number of bytes sent, which can end in the middle of any buffer, or error code same as {@link #send(long, long, int)}
+     */
+    public static native int sendv(long fd, long iov, int iovCnt);
+
     public native static int sendTo(long fd, long ptr, int len, long sockaddr);
 
+    /**
+     * Makes reads of the socket spin on the device queue for up to the given time
+     * instead of waiting for the interrupt, and prefers busy polling over interrupts
+     * where kernel supports it. Linux only.
+     *
+     * @param usec busy poll duration in microseconds, 0 disables busy polling
+     * @return 0 on success or -1 when option is not supported
+     */
+    public native static int setBusyPoll(long fd, int usec);
+
+    /**
+     * Pins the socket to CPU. When set on listening sockets of a SO_REUSEPORT group,
+     * Linux hands new connections to the socket pinned to the CPU that received them.
+     *
+     * @return 0 on success or -1 when option is not supported
+     */
+    public native static int setIncomingCpu(long fd, int cpu);
+
     public native static int setMulticastInterface(long fd, int ipv4address);
 
     public native static int setMulticastLoop(long fd, boolean loop);
@@ -190,10 +261,20 @@ public final class Net {
 
     public native static int setReusePort(long fd);
 
+    /**
+     * Enables reporting of socket drop counter with every received datagram (SO_RXQ_OVFL). Linux only.
+     */
+    public native static int setRxqOverflow(long fd, boolean enabled);
+
     public native static int setSndBuf(long fd, int size);
 
     public native static int setTcpNoDelay(long fd, boolean noDelay);
 
+    /**
+     * Lets kernel coalesce datagrams of the same flow into single message (UDP_GRO). Linux only.
+     */
+    public native static int setUdpGro(long fd, boolean enabled);
+
     public native static int shutdown(long fd, int how);
 
     public static long sockaddr(CharSequence ipv4address, int port) {
@@ -50,6 +50,8 @@ public interface NetworkFacade {
 
     void freeSockAddr(long socketAddress);
 
+    int getIncomingCpu(long fd);
+
     long getPeerIP(long fd);
 
     void listen(long serverFd, int backlog);
@@ -60,6 +62,10 @@ public interface NetworkFacade {
 
     int send(long fd, long buffer, int bufferLen);
 
+    long sendFile(long fd, long sockFd, long offset, long len);
+
+    int sendv(long fd, long iov, int iovCnt);
+
     int errno();
 
     long sockaddr(int address, int port);
@@ -88,6 +94,10 @@ public interface NetworkFacade {
 
     int parseIPv4(CharSequence ipv4Address);
 
+    int setBusyPoll(long fd, int usec);
+
+    int setIncomingCpu(long fd, int cpu);
+
     int setReusePort(long fd);
 
     int setTcpNoDelay(long fd, boolean noDelay);
@@ -100,11 +110,22 @@ public interface NetworkFacade {
 
     long getMMsgBufLen(long msg);
 
+    long getMMsgDropCount(long msgVec, int msgCount);
+
+    int getRcvBuf(long fd);
+
     long msgHeaders(int msgBufferSize, int msgCount);
 
     @SuppressWarnings("SpellCheckingInspection")
     int recvmmsg(long fd, long msgVec, int msgCount);
 
+    @SuppressWarnings("SpellCheckingInspection")
+    int recvmmsgSegments(long fd, long msgVec, int msgCount, long segVec, int segCapacity);
+
+    int setRxqOverflow(long fd, boolean enabled);
+
+    int setUdpGro(long fd, boolean enabled);
+
     boolean setSndBuf(long fd, int size);
 
     int getSndBuf(long fd);
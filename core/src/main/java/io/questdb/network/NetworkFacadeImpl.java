@@ -92,6 +92,11 @@ public class NetworkFacadeImpl implements NetworkFacade {
         Net.freeSockAddr(socketAddress);
     }
 
+    @Override
+    public int getIncomingCpu(long fd) {
+        return Net.getIncomingCpu(fd);
+    }
+
     @Override
     public long getPeerIP(long fd) {
         return Net.getPeerIP(fd);
@@ -117,6 +122,16 @@ public class NetworkFacadeImpl implements NetworkFacade {
         return Net.send(fd, buffer, bufferLen);
     }
 
+    @Override
+    public long sendFile(long fd, long sockFd, long offset, long len) {
+        return Net.sendFile(fd, sockFd, offset, len);
+    }
+
+    @Override
+    public int sendv(long fd, long iov, int iovCnt) {
+        return Net.sendv(fd, iov, iovCnt);
+    }
+
     @Override
     public int errno() {
         return Os.errno();
@@ -182,6 +197,16 @@ public class NetworkFacadeImpl implements NetworkFacade {
         return Net.parseIPv4(ipv4Address);
     }
 
+    @Override
+    public int setBusyPoll(long fd, int usec) {
+        return Net.setBusyPoll(fd, usec);
+    }
+
+    @Override
+    public int setIncomingCpu(long fd, int cpu) {
+        return Net.setIncomingCpu(fd, cpu);
+    }
+
     @Override
     public int setReusePort(long fd) {
         return Net.setReusePort(fd);
@@ -212,6 +237,16 @@ public class NetworkFacadeImpl implements NetworkFacade {
         return Net.getMMsgBufLen(msg);
     }
 
+    @Override
+    public long getMMsgDropCount(long msgVec, int msgCount) {
+        return Net.getMMsgDropCount(msgVec, msgCount);
+    }
+
+    @Override
+    public int getRcvBuf(long fd) {
+        return Net.getRcvBuf(fd);
+    }
+
     @Override
     public long msgHeaders(int msgBufferSize, int msgCount) {
         return Net.msgHeaders(msgBufferSize, msgCount);
@@ -222,6 +257,21 @@ public class NetworkFacadeImpl implements NetworkFacade {
         return Net.recvmmsg(fd, msgVec, msgCount);
     }
 
+    @Override
+    public int recvmmsgSegments(long fd, long msgVec, int msgCount, long segVec, int segCapacity) {
+        return Net.recvmmsgSegments(fd, msgVec, msgCount, segVec, segCapacity);
+    }
+
+    @Override
+    public int setRxqOverflow(long fd, boolean enabled) {
+        return Net.setRxqOverflow(fd, enabled);
+    }
+
+    @Override
+    public int setUdpGro(long fd, boolean enabled) {
+        return Net.setUdpGro(fd, enabled);
+    }
+
     @Override
     public boolean setSndBuf(long fd, int size) {
         return Net.setSndBuf(fd, size) == 0;
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.network;
+
+import io.questdb.std.datetime.millitime.MillisecondClock;
+
+/**
+ * Configuration of one of several dispatchers listening on the same port. Listening
+ * socket is bound with SO_REUSEPORT and pinned to the CPU of the worker owning the
+ * dispatcher, so that kernel hands connections to the dispatcher on the CPU that
+ * receives their packets. Everything else is taken from the shared configuration.
+ */
+public class ReusePortIODispatcherConfiguration implements IODispatcherConfiguration {
+    private final IODispatcherConfiguration delegate;
+    private final int listenerCpu;
+
+    public ReusePortIODispatcherConfiguration(IODispatcherConfiguration delegate, int listenerCpu) {
+        this.delegate = delegate;
+        this.listenerCpu = listenerCpu;
+    }
+
+    @Override
+    public int getLimit() {
+        return delegate.getLimit();
+    }
+
+    @Override
+    public int getBindIPv4Address() {
+        return delegate.getBindIPv4Address();
+    }
+
+    @Override
+    public int getBindPort() {
+        return delegate.getBindPort();
+    }
+
+    @Override
+    public int getBusyPollUsec() {
+        return delegate.getBusyPollUsec();
+    }
+
+    @Override
+    public MillisecondClock getClock() {
+        return delegate.getClock();
+    }
+
+    @Override
+    public String getDispatcherLogName() {
+        return delegate.getDispatcherLogName();
+    }
+
+    @Override
+    public EpollFacade getEpollFacade() {
+        return delegate.getEpollFacade();
+    }
+
+    @Override
+    public int getEventCapacity() {
+        return delegate.getEventCapacity();
+    }
+
+    @Override
+    public int getIOQueueCapacity() {
+        return delegate.getIOQueueCapacity();
+    }
+
+    @Override
+    public long getTimeout() {
+        return delegate.getTimeout();
+    }
+
+    @Override
+    public int getInitialBias() {
+        return delegate.getInitialBias();
+    }
+
+    @Override
+    public int getListenerCpu() {
+        return listenerCpu;
+    }
+
+    @Override
+    public int getInterestQueueCapacity() {
+        return delegate.getInterestQueueCapacity();
+    }
+
+    @Override
+    public boolean getHint() {
+        return delegate.getHint();
+    }
+
+    @Override
+    public int getListenBacklog() {
+        return delegate.getListenBacklog();
+    }
+
+    @Override
+    public NetworkFacade getNetworkFacade() {
+        return delegate.getNetworkFacade();
+    }
+
+    @Override
+    public boolean getPeerNoLinger() {
+        return delegate.getPeerNoLinger();
+    }
+
+    @Override
+    public int getRcvBufSize() {
+        return delegate.getRcvBufSize();
+    }
+
+    @Override
+    public SelectFacade getSelectFacade() {
+        return delegate.getSelectFacade();
+    }
+
+    @Override
+    public int getSndBufSize() {
+        return delegate.getSndBufSize();
+    }
+
+    @Override
+    public boolean isIOURingEnabled() {
+        return delegate.isIOURingEnabled();
+    }
+
+    @Override
+    public boolean isReusePortEnabled() {
+        return true;
+    }
+
+    @Override
+    public long getQueueTimeout() {
+        return delegate.getQueueTimeout();
+    }
+}
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.std;
+
+import io.questdb.std.str.LPSZ;
+
+import java.io.Closeable;
+
+/**
+ * Iterates directory entries, which are read in bulk via Files.scanDirNext() into
+ * native buffer. Compared to findFirst()/findNext(), this takes a JNI call per batch of
+ * entries rather than several per entry and optionally reports entry sizes
+ * without having to stat each file separately.
+ * <pre>
+ * if (scanner.of(ff, path, Files.SCAN_DIR_STAT)) {
+ *     while (scanner.next()) {
+ *         process(scanner.getName(), scanner.getType(), scanner.getSize());
+ *     }
+ * }
+ * </pre>
+ * Scanner can be reused for any number of directories, it is not thread-safe.
+ */
+public class DirScanner implements Closeable {
+    private final long bufferSize;
+    private long buffer;
+    private FilesFacade ff;
+    private long scanPtr;
+    private int flags;
+    private long entry;
+    private long entryLimit;
+
+    /**
+     * @param bufferSize size of native buffer, it has to be large enough for an entry with
+     *                   the longest file name OS allows
+     */
+    public DirScanner(long bufferSize) {
+        this.bufferSize = bufferSize;
+        this.buffer = Unsafe.malloc(bufferSize, MemoryTag.NATIVE_DEFAULT);
+    }
+
+    /**
+     * Releases directory of current scan, if any. Scanner remains usable.
+     */
+    public void clear() {
+        closeScan();
+    }
+
+    @Override
+    public void close() {
+        closeScan();
+        if (buffer != 0) {
+            Unsafe.free(buffer, bufferSize, MemoryTag.NATIVE_DEFAULT);
+            buffer = 0;
+        }
+    }
+
+    /**
+     * @return pointer to zero-terminated UTF-8 name of current entry, valid until next() is called
+     */
+    public long getName() {
+        return entry + Files.SCAN_DIR_NAME_OFFSET;
+    }
+
+    /**
+     * @return size of current entry or -1 when scan was opened without Files.SCAN_DIR_STAT flag
+     */
+    public long getSize() {
+        return Unsafe.getUnsafe().getLong(entry + Files.SCAN_DIR_SIZE_OFFSET);
+    }
+
+    /**
+     * @return type of current entry, one of Files.DT_* values
+     */
+    public int getType() {
+        return Unsafe.getUnsafe().getInt(entry + Files.SCAN_DIR_TYPE_OFFSET);
+    }
+
+    /**
+     * Moves to the next entry, reading next batch of entries when current one is exhausted.
+     * Directory is released once all entries are read.
+     *
+     * @return false when there are no more entries
+     */
+    public boolean next() {
+        if (entry < entryLimit) {
+            entry += Unsafe.getUnsafe().getInt(entry);
+            if (entry < entryLimit) {
+                return true;
+            }
+        }
+        if (scanPtr != 0) {
+            final long len;
+            try {
+                len = ff.scanDirNext(scanPtr, buffer, bufferSize, flags);
+            } catch (Throwable e) {
+                closeScan();
+                throw e;
+            }
+            if (len > 0) {
+                entry = buffer;
+                entryLimit = buffer + len;
+                return true;
+            }
+            closeScan();
+        }
+        return false;
+    }
+
+    /**
+     * Starts scan of the directory, closing previous scan if any.
+     *
+     * @param flags 0 or Files.SCAN_DIR_STAT
+     * @return false when directory does not exist
+     */
+    public boolean of(FilesFacade ff, LPSZ path, int flags) {
+        closeScan();
+        this.ff = ff;
+        this.flags = flags;
+        this.scanPtr = ff.scanDirOpen(path);
+        return scanPtr != 0;
+    }
+
+    private void closeScan() {
+        if (scanPtr != 0) {
+            ff.scanDirClose(scanPtr);
+            scanPtr = 0;
+        }
+        entry = 0;
+        entryLimit = 0;
+    }
+}
@@ -41,6 +41,31 @@ public final class Files {
     public static final int DT_DIR = 4;
     public static final int MAP_RO = 1;
     public static final int MAP_RW = 2;
+    // can be or-ed with MAP_RO or MAP_RW to pre-fault mapped pages, honoured on Linux only
+    public static final int MAP_POPULATE = 16;
+    // can be or-ed with MAP_RO or MAP_RW to place mapping at the given base address, replacing pages mapped there
+    public static final int MAP_FIXED = 32;
+    // access pattern hints for madvise(), values are translated to OS constants natively
+    public static final int POSIX_MADV_NORMAL = 0;
+    public static final int POSIX_MADV_RANDOM = 1;
+    public static final int POSIX_MADV_SEQUENTIAL = 2;
+    public static final int POSIX_MADV_WILLNEED = 3;
+    public static final int POSIX_MADV_DONTNEED = 4;
+    // Linux specific hints, ignored on other platforms
+    public static final int MADV_HUGEPAGE = 14;
+    public static final int MADV_COLD = 20;
+    // offset, length and buffer address of writes to descriptors returned by openDirect() must be aligned to this value
+    public static final long DIRECT_IO_ALIGNMENT = 4096;
+    // methods of copyData(), Linux only: reflink of whole file, copy_file_range() and sendfile()
+    public static final int COPY_METHOD_CLONE = 0;
+    public static final int COPY_METHOD_RANGE = 1;
+    public static final int COPY_METHOD_SENDFILE = 2;
+    // flag for scanDirNext() to report sizes of entries, size is -1 otherwise
+    public static final int SCAN_DIR_STAT = 1;
+    // layout of entries packed by scanDirNext(): int entry length, int type, long size, zero-terminated UTF-8 name
+    public static final int SCAN_DIR_TYPE_OFFSET = 4;
+    public static final int SCAN_DIR_SIZE_OFFSET = 8;
+    public static final int SCAN_DIR_NAME_OFFSET = 16;
     public static final char SEPARATOR;
 
     static final AtomicLong OPEN_FILE_COUNT = new AtomicLong();
@@ -99,12 +124,63 @@ public final class Files {
         return res;
     }
 
-    public static native int copy(long from, long to);
-
     public static int copy(LPSZ from, LPSZ to) {
-        return copy(from.address(), to.address());
+        return copy(FilesFacadeImpl.INSTANCE, from, to);
     }
 
+    /**
+     * Copies file. On Linux copy is attempted with reflink first, which shares extents on
+     * copy-on-write file systems, then with copy_file_range(), which keeps data in the kernel,
+     * and finally with sendfile(), which works across file systems on any kernel. Every method
+     * goes through the facade, so that each fallback can be exercised.
+     *
+     * @return 0 on success, -1 on error
+     */
+    public static int copy(FilesFacade ff, LPSZ from, LPSZ to) {
+        if (Os.type != Os.LINUX_AMD64 && Os.type != Os.LINUX_ARM64) {
+            return copy(from.address(), to.address());
+        }
+
+        final long srcFd = ff.openRO(from);
+        if (srcFd < 0) {
+            return -1;
+        }
+        final long dstFd = ff.openRW(to, 0);
+        try {
+            final long length = ff.length(srcFd);
+            if (dstFd < 0 || length < 0 || !ff.truncate(dstFd, 0)) {
+                return -1;
+            }
+            int method = COPY_METHOD_CLONE;
+            while (true) {
+                final long n = ff.copyData(srcFd, dstFd, 0, 0, length, method);
+                if (n == length) {
+                    return 0;
+                }
+                // reflink fails on anything but copy-on-write file systems, copy_file_range() fails
+                // on old kernels and across file systems; bytes are copied by the next method then
+                if (n > -1 || method == COPY_METHOD_SENDFILE || (method == COPY_METHOD_RANGE && !isCopyMethodUnsupported(ff.errno()))) {
+                    return -1;
+                }
+                method++;
+            }
+        } finally {
+            ff.close(srcFd);
+            if (dstFd > -1) {
+                ff.close(dstFd);
+            }
+        }
+    }
+
+    /**
+     * Copies range of bytes between two open files with given method, Linux only.
+     * {@link #COPY_METHOD_CLONE} copies whole file and requires both offsets to be 0.
+     *
+     * @return number of bytes copied, which is less than length when source file ends
+     * sooner, or -1 on error
+     */
+    public static native long copyData(long srcFd, long dstFd, long srcOffset, long dstOffset, long length, int method);
+
     public static native boolean exists(long fd);
 
     public static boolean exists(LPSZ lpsz) {
@@ -217,6 +293,22 @@ public final class Files {
         return 0;
     }
 
+    /**
+     * Advises OS on how mapped memory is going to be accessed. Advice is a hint and
+     * OS is free to ignore it, as are the platforms that do not support given advice.
+     *
+     * @param address start of mapped region, must be page aligned
+     * @param len     length of the region
+     * @param advice  one of POSIX_MADV_* or MADV_* constants
+     * @return 0 on success, -1 on error, in which case errno() returns error code
+     */
+    public static int madvise(long address, long len, int advice) {
+        if (address != 0 && len > 0) {
+            return madvise0(address, len, advice);
+        }
+        return 0;
+    }
+
     public static long mmap(long fd, long len, long offset, int flags, int memoryTag) {
         return mmap(fd, len, offset, flags, 0, memoryTag);
     }
@@ -229,6 +321,43 @@ public final class Files {
         return address;
     }
 
+    /**
+     * Reserves range of virtual address space without committing any memory to it. File mapped
+     * at the start of the range via {@link #mremapFixed(long, long, long, long, int, int)} can
+     * grow in place, its address stays the same until it outgrows the reservation.
+     *
+     * @param len size of the range
+     * @return address of the range or -1 when reservation is not supported, e.g. on Windows
+     */
+    public static long mmapReserve(long len) {
+        return mmapReserve0(len, 0);
+    }
+
+    /**
+     * Resizes file mapping placed at the start of reserved address range without moving it.
+     * Growing maps the tail of the file over reserved pages, shrinking returns pages back
+     * to the reservation.
+     *
+     * @return address of the mapping, which is the same as the one passed in, or -1 on error
+     */
+    public static long mremapFixed(long fd, long address, long previousSize, long newSize, int flags, int memoryTag) {
+        if (newSize > previousSize) {
+            // remap partially mapped last page together with the tail
+            final long offset = previousSize - previousSize % PAGE_SIZE;
+            if (mmap0(fd, newSize - offset, offset, flags | MAP_FIXED, address + offset) == -1) {
+                return -1;
+            }
+        } else {
+            final long lo = ceilPageSize(newSize);
+            final long hi = ceilPageSize(previousSize);
+            if (hi > lo && mmapReserve0(hi - lo, address + lo) == -1) {
+                return -1;
+            }
+        }
+        Unsafe.recordMemAlloc(newSize - previousSize, memoryTag);
+        return address;
+    }
+
     public static long mremap(long fd, long address, long previousSize, long newSize, long offset, int flags, int memoryTag) {
         Unsafe.recordMemAlloc(-previousSize, memoryTag);
         address = mremap0(fd, address, previousSize, newSize, offset, flags);
@@ -246,6 +375,17 @@ public final class Files {
         }
     }
 
+    /**
+     * Releases reserved address range together with file mapped at its start.
+     *
+     * @param mappedSize size of the file mapping, as accounted by memory tag
+     */
+    public static void munmapReserve(long address, long reservedSize, long mappedSize, int memoryTag) {
+        if (address != 0 && munmap0(address, reservedSize) != -1) {
+            Unsafe.recordMemAlloc(-mappedSize, memoryTag);
+        }
+    }
+
     public static boolean notDots(CharSequence value) {
         final int len = value.length();
         if (len > 2) {
@@ -278,6 +418,17 @@ public final class Files {
 
     public native static long openCleanRW(long lpszName, long size);
 
+    /**
+     * Opens a separate write-only descriptor to the same file, which bypasses page cache.
+     * Writes to the original descriptor are not affected.
+     *
+     * @param fd descriptor of the open file
+     * @return new descriptor or -1 when file system or OS does not support direct I/O
+     */
+    public static long openDirect(long fd) {
+        return bumpFileCount(openDirect0(fd));
+    }
+
     public static long openRO(LPSZ lpsz) {
         return bumpFileCount(openRO(lpsz.address()));
     }
@@ -340,6 +491,29 @@ public final class Files {
         return errno;
     }
 
+    public native static void scanDirClose(long scanPtr);
+
+    /**
+     * Packs as many directory entries as fit into the buffer. Entries are 8-byte aligned,
+     * their layout is described by SCAN_DIR_*_OFFSET constants.
+     *
+     * @param scanPtr value returned by scanDirOpen()
+     * @param address buffer address
+     * @param len     buffer length, must be able to take an entry with the longest file name
+     * @param flags   0 or SCAN_DIR_STAT to read entry sizes
+     * @return number of bytes written to the buffer, 0 when there are no more entries and -1 on error
+     */
+    public native static long scanDirNext(long scanPtr, long address, long len, int flags);
+
+    /**
+     * Opens directory for bulk scan. Caller must call scanDirClose() to release the scan.
+     *
+     * @return scan pointer, 0 when directory does not exist and -1 on error
+     */
+    public static long scanDirOpen(LPSZ path) {
+        return scanDirOpen0(path.address());
+    }
+
     public static boolean setLastModified(LPSZ lpsz, long millis) {
         return setLastModified(lpsz.address(), millis);
     }
@@ -361,8 +535,15 @@ public final class Files {
 
     private native static int close0(long fd);
 
+    private static native int copy(long from, long to);
+
     private static native boolean exists0(long lpsz);
 
+    private static boolean isCopyMethodUnsupported(int errno) {
+        // ENOSYS, EXDEV, EINVAL or EOPNOTSUPP
+        return errno == 38 || errno == 18 || errno == 22 || errno == 95;
+    }
+
     private static boolean strcmp(long lpsz, CharSequence s) {
         int len = s.length();
         for (int i = 0; i < len; i++) {
@@ -374,12 +555,18 @@ public final class Files {
         return Unsafe.getUnsafe().getByte(lpsz + len) == 0;
     }
 
+    private static native int madvise0(long address, long len, int advice);
+
     private static native int munmap0(long address, long len);
 
+    private static native long openDirect0(long fd);
+
     private static native long mremap0(long fd, long address, long previousSize, long newSize, long offset, int flags);
 
     private static native long mmap0(long fd, long len, long offset, int flags, long baseAddress);
 
+    private static native long mmapReserve0(long len, long baseAddress);
+
     private native static long getPageSize();
 
     private native static boolean remove(long lpsz);
@@ -403,6 +590,8 @@ public final class Files {
     //caller must call findClose to free allocated struct 
     private native static long findFirst(long lpszName);
 
+    private native static long scanDirOpen0(long lpszName);
+
     private native static boolean setLastModified(long lpszName, long millis);
 
     private static native boolean rename(long lpszOld, long lpszNew);
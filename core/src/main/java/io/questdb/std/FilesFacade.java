@@ -36,6 +36,8 @@ public interface FilesFacade {
 
     int copy(LPSZ from, LPSZ to);
 
+    long copyData(long srcFd, long dstFd, long srcOffset, long dstOffset, long length, int method);
+
     int errno();
 
     boolean exists(LPSZ path);
@@ -76,6 +78,8 @@ public interface FilesFacade {
 
     int lock(long fd);
 
+    int madvise(long address, long len, int advice);
+
     int mkdir(LPSZ path, int mode);
 
     int mkdirs(LPSZ path, int mode);
@@ -84,12 +88,20 @@ public interface FilesFacade {
 
     long mmap(long fd, long len, long offset, int flags, long baseAddress, int memoryTag);
 
+    long mmapReserve(long len);
+
     long mremap(long fd, long addr, long previousSize, long newSize, long offset, int mode, int memoryTag);
 
+    long mremapFixed(long fd, long addr, long previousSize, long newSize, int mode, int memoryTag);
+
     void munmap(long address, long size, int memoryTag);
 
+    void munmapReserve(long address, long reservedSize, long mappedSize, int memoryTag);
+
     long openAppend(LPSZ name);
 
+    long openDirect(long fd);
+
     long openRO(LPSZ name);
 
     long openRW(LPSZ name, long opts);
@@ -106,6 +118,12 @@ public interface FilesFacade {
 
     int rmdir(Path name);
 
+    void scanDirClose(long scanPtr);
+
+    long scanDirNext(long scanPtr, long address, long len, int flags);
+
+    long scanDirOpen(LPSZ path);
+
     boolean touch(LPSZ path);
 
     boolean truncate(long fd, long size);
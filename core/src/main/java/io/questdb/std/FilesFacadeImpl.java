@@ -46,7 +46,12 @@ public class FilesFacadeImpl implements FilesFacade {
 
     @Override
     public int copy(LPSZ from, LPSZ to) {
-        return Files.copy(from, to);
+        return Files.copy(this, from, to);
+    }
+
+    @Override
+    public long copyData(long srcFd, long dstFd, long srcOffset, long dstOffset, long length, int method) {
+        return Files.copyData(srcFd, dstFd, srcOffset, dstOffset, length, method);
     }
 
     @Override
@@ -173,6 +178,11 @@ public class FilesFacadeImpl implements FilesFacade {
         return Files.lock(fd);
     }
 
+    @Override
+    public int madvise(long address, long len, int advice) {
+        return Files.madvise(address, len, advice);
+    }
+
     @Override
     public int mkdir(LPSZ path, int mode) {
         return Files.mkdir(path, mode);
@@ -189,8 +199,13 @@ public class FilesFacadeImpl implements FilesFacade {
     }
 
     @Override
-    public long mmap(long fd, long len, long flags, int mode, long baseAddress, int memoryTag) {
-        return Files.mmap(fd, len, flags, mode, memoryTag);
+    public long mmap(long fd, long len, long offset, int flags, long baseAddress, int memoryTag) {
+        return Files.mmap(fd, len, offset, flags, baseAddress, memoryTag);
+    }
+
+    @Override
+    public long mmapReserve(long len) {
+        return Files.mmapReserve(len);
     }
 
     @Override
@@ -198,16 +213,31 @@ public class FilesFacadeImpl implements FilesFacade {
         return Files.mremap(fd, addr, previousSize, newSize, offset, mode, memoryTag);
     }
 
+    @Override
+    public long mremapFixed(long fd, long addr, long previousSize, long newSize, int mode, int memoryTag) {
+        return Files.mremapFixed(fd, addr, previousSize, newSize, mode, memoryTag);
+    }
+
     @Override
     public void munmap(long address, long size, int memoryTag) {
         Files.munmap(address, size, memoryTag);
     }
 
+    @Override
+    public void munmapReserve(long address, long reservedSize, long mappedSize, int memoryTag) {
+        Files.munmapReserve(address, reservedSize, mappedSize, memoryTag);
+    }
+
     @Override
     public long openAppend(LPSZ name) {
         return Files.openAppend(name);
     }
 
+    @Override
+    public long openDirect(long fd) {
+        return Files.openDirect(fd);
+    }
+
     @Override
     public long openRO(LPSZ name) {
         return Files.openRO(name);
@@ -252,6 +282,29 @@ public class FilesFacadeImpl implements FilesFacade {
         return Files.rmdir(name);
     }
 
+    @Override
+    public void scanDirClose(long scanPtr) {
+        Files.scanDirClose(scanPtr);
+    }
+
+    @Override
+    public long scanDirNext(long scanPtr, long address, long len, int flags) {
+        long r = Files.scanDirNext(scanPtr, address, len, flags);
+        if (r == -1) {
+            throw CairoException.instance(Os.errno()).put("scanDirNext failed");
+        }
+        return r;
+    }
+
+    @Override
+    public long scanDirOpen(LPSZ path) {
+        long ptr = Files.scanDirOpen(path);
+        if (ptr == -1) {
+            throw CairoException.instance(Os.errno()).put("scanDirOpen failed on ").put(path);
+        }
+        return ptr;
+    }
+
     @Override
     public boolean touch(LPSZ path) {
         return Files.touch(path);
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.std;
+
+/**
+ * Native checksums and hashes. Gzip CRC32 is {@link Zip#crc32(int, long, int)}.
+ */
+public final class HashNative {
+
+    private HashNative() {
+    }
+
+    /**
+     * Updates CRC32C (Castagnoli) checksum, the same as java.util.zip.CRC32C.
+     * Runs on SSE4.2 or ARMv8 CRC instructions when CPU has them.
+     *
+     * @param crc checksum of the preceding data or 0
+     * @return updated checksum
+     */
+    public static native int crc32c(int crc, long address, long len);
+
+    /**
+     * Hashes each of count 8 byte values at address into 8 byte hash at hashesAddress.
+     */
+    public static native void hashLongColumn(long address, long count, long hashesAddress);
+
+    /**
+     * Fast 64-bit hash of memory, suitable for hash tables and dedup, but not cryptography.
+     */
+    public static native long hashMem64(long address, long len);
+
+    /**
+     * Hashes string column values of rows [lo, hi) into 8 byte hashes at hashesAddress,
+     * the same as {@link #hashMem64(long, long)} of their UTF-16 chars. Null and empty
+     * strings hash to 0.
+     *
+     * @param indexAddress address of column index, which holds 8 byte data offset per row
+     */
+    public static native void hashStrColumn(long dataAddress, long indexAddress, long lo, long hi, long hashesAddress);
+
+    static {
+        Os.init();
+    }
+}
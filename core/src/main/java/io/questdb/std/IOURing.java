@@ -0,0 +1,230 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.std;
+
+import io.questdb.cairo.CairoException;
+
+import java.io.Closeable;
+
+/**
+ * Asynchronous file and socket I/O on top of Linux io_uring. Operations are queued with one of
+ * the enqueue*() methods, which return operation id, sent to the kernel in batches
+ * via submit() and their results are polled with nextCqe().
+ * <p>
+ * The ring is not thread-safe, each thread is expected to own its instance.
+ */
+public class IOURing implements Closeable {
+    public static final int OP_NOP = 0;
+    public static final int OP_READ = 1;
+    public static final int OP_WRITE = 2;
+    public static final int OP_FSYNC = 3;
+    public static final int OP_FDATASYNC = 4;
+    public static final int OP_FALLOCATE = 5;
+    public static final int OP_SYNC_FILE_RANGE = 6;
+    public static final int OP_POLL_ADD = 7;
+    public static final int OP_POLL_REMOVE = 8;
+    // poll events, values are fixed by Linux ABI
+    public static final int POLLIN = 0x1;
+    public static final int POLLOUT = 0x4;
+    // next operation does not start until this one completes successfully
+    public static final int FLAG_LINK = 1;
+
+    private static final boolean AVAILABLE;
+    private final int capacity;
+    private final long cqeBuf;
+    private long ring;
+    private long idSeq = 0;
+    private int cqeCount = 0;
+    private int cqeIndex = 0;
+    private long cqeId = -1;
+    private long cqeRes = -1;
+
+    public IOURing(int capacity) {
+        assert AVAILABLE;
+        this.capacity = Numbers.ceilPow2(capacity);
+        this.ring = create(this.capacity);
+        if (ring == -1) {
+            throw CairoException.instance(Os.errno()).put("could not create io_uring [capacity=").put(this.capacity).put(']');
+        }
+        // completion queue is twice the size of submission queue
+        this.cqeBuf = Unsafe.malloc(2 * this.capacity * 16L, MemoryTag.NATIVE_DEFAULT);
+    }
+
+    /**
+     * @return true when running kernel supports io_uring and it is not disabled by security policy
+     */
+    public static boolean isAvailable() {
+        return AVAILABLE;
+    }
+
+    @Override
+    public void close() {
+        if (ring != 0) {
+            close0(ring);
+            Unsafe.free(cqeBuf, 2 * capacity * 16L, MemoryTag.NATIVE_DEFAULT);
+            ring = 0;
+        }
+    }
+
+    /**
+     * Queues operation without submitting it to the kernel.
+     *
+     * @return operation id, which is reported back with completion, or -1 when submission queue is full
+     */
+    public long enqueue(int op, long fd, long offset, long address, long len, int flags) {
+        final long id = idSeq;
+        if (prep(ring, op, fd, offset, address, len, id, flags) == 1) {
+            idSeq++;
+            return id;
+        }
+        return -1;
+    }
+
+    public long enqueueFallocate(long fd, long offset, long len) {
+        return enqueue(OP_FALLOCATE, fd, offset, 0, len, 0);
+    }
+
+    public long enqueueFdatasync(long fd) {
+        return enqueue(OP_FDATASYNC, fd, 0, 0, 0, 0);
+    }
+
+    public long enqueueFsync(long fd) {
+        return enqueue(OP_FSYNC, fd, 0, 0, 0, 0);
+    }
+
+    public long enqueueNop() {
+        return enqueue(OP_NOP, -1, 0, 0, 0, 0);
+    }
+
+    /**
+     * Queues one-shot poll of the file descriptor. Completion result is the mask of
+     * ready events or -errno. Poll is completed with -ECANCELED when it is removed.
+     *
+     * @param events POLLIN and/or POLLOUT
+     */
+    public long enqueuePollAdd(long fd, int events) {
+        return enqueue(OP_POLL_ADD, fd, 0, 0, events, 0);
+    }
+
+    /**
+     * Queues removal of poll that has not completed yet.
+     *
+     * @param pollId operation id returned by {@link #enqueuePollAdd(long, int)}
+     */
+    public long enqueuePollRemove(long pollId) {
+        return enqueue(OP_POLL_REMOVE, -1, 0, pollId, 0, 0);
+    }
+
+    public long enqueueRead(long fd, long offset, long address, long len) {
+        return enqueue(OP_READ, fd, offset, address, len, 0);
+    }
+
+    public long enqueueSyncFileRange(long fd, long offset, long len, int flags) {
+        return enqueue(OP_SYNC_FILE_RANGE, fd, offset, 0, len, flags);
+    }
+
+    public long enqueueWrite(long fd, long offset, long address, long len, int flags) {
+        return enqueue(OP_WRITE, fd, offset, address, len, flags);
+    }
+
+    public long enqueueWrite(long fd, long offset, long address, long len) {
+        return enqueueWrite(fd, offset, address, len, 0);
+    }
+
+    public int getCapacity() {
+        return capacity;
+    }
+
+    /**
+     * @return id of the operation the current completion belongs to
+     */
+    public long getCqeId() {
+        return cqeId;
+    }
+
+    /**
+     * @return result of the current completion, same as the result of the equivalent
+     * system call with the exception of errors, which are reported as -errno
+     */
+    public long getCqeRes() {
+        return cqeRes;
+    }
+
+    /**
+     * Moves to the next completion. Completions are not necessarily ordered
+     * in the same way operations were enqueued.
+     *
+     * @return false when there are no more completions available without blocking
+     */
+    public boolean nextCqe() {
+        if (cqeIndex == cqeCount) {
+            cqeIndex = 0;
+            cqeCount = reap(ring, cqeBuf, 2 * capacity);
+            if (cqeCount == 0) {
+                return false;
+            }
+        }
+        final long p = cqeBuf + cqeIndex * 16L;
+        cqeId = Unsafe.getUnsafe().getLong(p);
+        cqeRes = Unsafe.getUnsafe().getLong(p + 8);
+        cqeIndex++;
+        return true;
+    }
+
+    /**
+     * Submits queued operations to the kernel without waiting for their completion.
+     *
+     * @return number of submitted operations or -errno
+     */
+    public int submit() {
+        return submit(ring, 0);
+    }
+
+    /**
+     * Submits queued operations and waits until at least waitNr operations complete.
+     *
+     * @return number of submitted operations or -errno
+     */
+    public int submitAndWait(int waitNr) {
+        return submit(ring, waitNr);
+    }
+
+    private static native long create(int capacity);
+
+    private static native void close0(long ring);
+
+    private static native boolean isAvailable0();
+
+    private static native int prep(long ring, int op, long fd, long offset, long address, long len, long userData, int flags);
+
+    private static native int reap(long ring, long address, int max);
+
+    private static native int submit(long ring, int waitNr);
+
+    static {
+        Os.init();
+        AVAILABLE = (Os.type == Os.LINUX_AMD64 || Os.type == Os.LINUX_ARM64) && isAvailable0();
+    }
+}
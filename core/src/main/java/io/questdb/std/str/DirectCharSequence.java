@@ -27,7 +27,7 @@ package io.questdb.std.str;
 import io.questdb.std.Mutable;
 import io.questdb.std.Unsafe;
 
-public class DirectCharSequence extends AbstractCharSequence implements Mutable {
+public class DirectCharSequence extends AbstractCharSequence implements DirectUtf16Sequence, Mutable {
     private long lo;
     private long hi;
     private int len;
@@ -37,6 +37,11 @@ public class DirectCharSequence extends AbstractCharSequence implements Mutable
         hi = lo = 0;
     }
 
+    @Override
+    public long getAddress() {
+        return lo;
+    }
+
     @Override
     public int hashCode() {
         if (lo == hi) {
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.tasks;
+
+import io.questdb.std.str.StringSink;
+
+public class PartitionChecksumTask {
+    public static final int MODE_WRITE = 0;
+    public static final int MODE_VERIFY = 1;
+    private final StringSink partitionPath = new StringSink();
+    private int mode;
+
+    public int getMode() {
+        return mode;
+    }
+
+    public CharSequence getPartitionPath() {
+        return partitionPath;
+    }
+
+    public void of(CharSequence partitionPath, int mode) {
+        this.partitionPath.clear();
+        this.partitionPath.put(partitionPath);
+        this.mode = mode;
+    }
+}
@@ -31,6 +31,7 @@ import io.questdb.std.str.Path;
 import io.questdb.std.str.StringSink;
 import io.questdb.test.tools.TestUtils;
 import org.junit.Assert;
+import org.junit.Assume;
 import org.junit.Rule;
 import org.junit.Test;
 import org.junit.rules.TemporaryFolder;
@@ -145,6 +146,65 @@ public class FilesTest {
         });
     }
 
+    @Test
+    public void testCopyData() throws Exception {
+        Assume.assumeTrue(Os.type == Os.LINUX_AMD64 || Os.type == Os.LINUX_ARM64);
+        assertMemoryLeak(() -> {
+            final File temp = temporaryFolder.newFile();
+            final int fileSize = 3 * 1024 * 1024 + 7;
+            writeRandomFile(temp, fileSize);
+
+            final int chunkSize = 1024 * 1024;
+            for (int method : new int[]{Files.COPY_METHOD_RANGE, Files.COPY_METHOD_SENDFILE}) {
+                try (
+                        Path path = new Path().of(temp.getAbsolutePath()).$();
+                        Path copyPath = new Path().of(temp.getAbsolutePath()).put("-copy-").put(method).$()
+                ) {
+                    final long srcFd = Files.openRO(path);
+                    Assert.assertTrue(srcFd > -1);
+                    final long dstFd = Files.openRW(copyPath);
+                    Assert.assertTrue(dstFd > -1);
+                    try {
+                        // last chunk asks for more than is left in the file
+                        for (long offset = 0; offset < fileSize; offset += chunkSize) {
+                            final long expected = Math.min(chunkSize, fileSize - offset);
+                            Assert.assertEquals(expected, Files.copyData(srcFd, dstFd, offset, offset, chunkSize, method));
+                        }
+                    } finally {
+                        Files.close(srcFd);
+                        Files.close(dstFd);
+                    }
+                    Assert.assertEquals(fileSize, Files.length(copyPath));
+                    TestUtils.assertFileContentsEquals(path, copyPath);
+                }
+            }
+        });
+    }
+
+    @Test
+    public void testCopyFailsOnIOError() throws Exception {
+        // EIO from copy_file_range() is not a reason to try sendfile()
+        assertCopyFallback(new int[]{95, 5, 0}, Files.COPY_METHOD_RANGE, false);
+    }
+
+    @Test
+    public void testCopyFallsBackToCopyFileRange() throws Exception {
+        // EOPNOTSUPP from reflink
+        assertCopyFallback(new int[]{95, 0, 0}, Files.COPY_METHOD_RANGE, true);
+    }
+
+    @Test
+    public void testCopyFallsBackToSendFileOnCrossDevice() throws Exception {
+        // EXDEV from reflink and copy_file_range()
+        assertCopyFallback(new int[]{18, 18, 0}, Files.COPY_METHOD_SENDFILE, true);
+    }
+
+    @Test
+    public void testCopyFallsBackToSendFileOnInvalidArgument() throws Exception {
+        // EINVAL from reflink and copy_file_range()
+        assertCopyFallback(new int[]{22, 22, 0}, Files.COPY_METHOD_SENDFILE, true);
+    }
+
     @Test
     public void testDeleteDir2() throws Exception {
         assertMemoryLeak(() -> {
@@ -245,6 +305,39 @@ public class FilesTest {
         });
     }
 
+    @Test
+    public void testMadvise() throws Exception {
+        assertMemoryLeak(() -> {
+            File temp = temporaryFolder.newFile();
+            try (Path path = new Path().of(temp.getAbsolutePath()).$()) {
+                long fd = Files.openRW(path);
+                try {
+                    final long size = 16 * Files.PAGE_SIZE;
+                    Assert.assertTrue(Files.allocate(fd, size));
+                    long address = Files.mmap(fd, size, 0, Files.MAP_RW, MemoryTag.MMAP_DEFAULT);
+                    Assert.assertNotEquals(FilesFacade.MAP_FAILED, address);
+                    try {
+                        Unsafe.getUnsafe().putLong(address, 42);
+                        Assert.assertEquals(0, Files.madvise(address, size, Files.POSIX_MADV_SEQUENTIAL));
+                        Assert.assertEquals(0, Files.madvise(address, size, Files.POSIX_MADV_WILLNEED));
+                        Assert.assertEquals(0, Files.madvise(address, size, Files.POSIX_MADV_RANDOM));
+                        Assert.assertEquals(0, Files.madvise(address, size, Files.POSIX_MADV_NORMAL));
+                        // Linux specific hints are not guaranteed to be supported by the kernel,
+                        // but they must not affect mapped data
+                        Files.madvise(address, size, Files.MADV_COLD);
+                        Assert.assertEquals(42, Unsafe.getUnsafe().getLong(address));
+                        // empty range is a no-op
+                        Assert.assertEquals(0, Files.madvise(0, size, Files.POSIX_MADV_DONTNEED));
+                    } finally {
+                        Files.munmap(address, size, MemoryTag.MMAP_DEFAULT);
+                    }
+                } finally {
+                    Files.close(fd);
+                }
+            }
+        });
+    }
+
     @Test
     public void testMkdirs() throws Exception {
         assertMemoryLeak(() -> {
@@ -261,6 +354,29 @@ public class FilesTest {
         });
     }
 
+    @Test
+    public void testMmapPopulate() throws Exception {
+        assertMemoryLeak(() -> {
+            File temp = temporaryFolder.newFile();
+            TestUtils.writeStringToFile(temp, "abcde");
+            try (Path path = new Path().of(temp.getAbsolutePath()).$()) {
+                long fd = Files.openRO(path);
+                try {
+                    long address = Files.mmap(fd, 5, 0, Files.MAP_RO | Files.MAP_POPULATE, MemoryTag.MMAP_DEFAULT);
+                    Assert.assertNotEquals(FilesFacade.MAP_FAILED, address);
+                    try {
+                        Assert.assertEquals('a', Unsafe.getUnsafe().getByte(address));
+                        Assert.assertEquals('e', Unsafe.getUnsafe().getByte(address + 4));
+                    } finally {
+                        Files.munmap(address, 5, MemoryTag.MMAP_DEFAULT);
+                    }
+                } finally {
+                    Files.close(fd);
+                }
+            }
+        });
+    }
+
     @Test
     public void testOpenCleanRWAllocatesToSize() throws Exception {
         assertMemoryLeak(() -> {
@@ -337,6 +453,59 @@ public class FilesTest {
         });
     }
 
+    @Test
+    public void testScanDir() throws Exception {
+        assertMemoryLeak(() -> {
+            final String temp = temporaryFolder.newFolder().getAbsolutePath();
+            final int fileCount = 500;
+            try (
+                    Path path = new Path().of(temp).$();
+                    Path cp = new Path();
+                    // small buffer to make scanner go through many batches
+                    DirScanner scanner = new DirScanner(1024)
+            ) {
+                for (int i = 0; i < fileCount; i++) {
+                    long fd = Files.openRW(cp.of(temp).concat("file_").put(i).put(".d").$());
+                    Assert.assertTrue(fd > -1);
+                    Assert.assertTrue(Files.truncate(fd, i));
+                    Files.close(fd);
+                }
+                Assert.assertEquals(0, Files.mkdir(cp.of(temp).concat("dir").$(), 509));
+
+                StringSink nameSink = new StringSink();
+                int files = 0;
+                long totalSize = 0;
+                ObjList<String> dirs = new ObjList<>();
+                Assert.assertTrue(scanner.of(FilesFacadeImpl.INSTANCE, path, Files.SCAN_DIR_STAT));
+                while (scanner.next()) {
+                    nameSink.clear();
+                    Chars.utf8DecodeZ(scanner.getName(), nameSink);
+                    if (scanner.getType() == Files.DT_DIR) {
+                        dirs.add(nameSink.toString());
+                    } else {
+                        Assert.assertEquals(Files.DT_FILE, scanner.getType());
+                        final int index = Numbers.parseInt(nameSink, 5, nameSink.length() - 2);
+                        Assert.assertEquals(index, scanner.getSize());
+                        totalSize += scanner.getSize();
+                        files++;
+                    }
+                }
+                dirs.sort(Chars::compare);
+                Assert.assertEquals("[.,..,dir]", dirs.toString());
+                Assert.assertEquals(fileCount, files);
+                Assert.assertEquals((long) fileCount * (fileCount - 1) / 2, totalSize);
+
+                // sizes are not reported without stat flag
+                Assert.assertTrue(scanner.of(FilesFacadeImpl.INSTANCE, path, 0));
+                Assert.assertTrue(scanner.next());
+                Assert.assertEquals(-1, scanner.getSize());
+
+                Assert.assertFalse(scanner.of(FilesFacadeImpl.INSTANCE, cp.of(temp).concat("xyz").$(), 0));
+                Assert.assertFalse(scanner.next());
+            }
+        });
+    }
+
     @Test
     public void testTruncate() throws Exception {
         assertMemoryLeak(() -> {
@@ -370,4 +539,59 @@ public class FilesTest {
         Assert.assertTrue(Files.setLastModified(path, t));
         Assert.assertEquals(t, Files.getLastModified(path));
     }
+
+    // errnos[method] is the error copy method fails with, 0 lets it copy
+    private void assertCopyFallback(int[] errnos, int lastMethod, boolean success) throws Exception {
+        Assume.assumeTrue(Os.type == Os.LINUX_AMD64 || Os.type == Os.LINUX_ARM64);
+        assertMemoryLeak(() -> {
+            final File temp = temporaryFolder.newFile();
+            final int fileSize = 2 * 1024 * 1024 + 3;
+            writeRandomFile(temp, fileSize);
+
+            final IntList methods = new IntList();
+            final int[] errno = {0};
+            final FilesFacade ff = new FilesFacadeImpl() {
+                @Override
+                public long copyData(long srcFd, long dstFd, long srcOffset, long dstOffset, long length, int method) {
+                    methods.add(method);
+                    if (errnos[method] != 0) {
+                        errno[0] = errnos[method];
+                        return -1;
+                    }
+                    return super.copyData(srcFd, dstFd, srcOffset, dstOffset, length, method);
+                }
+
+                @Override
+                public int errno() {
+                    return errno[0];
+                }
+            };
+
+            try (
+                    Path path = new Path().of(temp.getAbsolutePath()).$();
+                    Path copyPath = new Path().of(temp.getAbsolutePath()).put("-copy").$()
+            ) {
+                Assert.assertEquals(success ? 0 : -1, ff.copy(path, copyPath));
+                Assert.assertEquals(lastMethod + 1, methods.size());
+                for (int i = 0; i <= lastMethod; i++) {
+                    Assert.assertEquals(i, methods.getQuick(i));
+                }
+                if (success) {
+                    Assert.assertEquals(fileSize, Files.length(copyPath));
+                    TestUtils.assertFileContentsEquals(path, copyPath);
+                }
+            }
+        });
+    }
+
+    private static void writeRandomFile(File file, int size) throws IOException {
+        final byte[] bytes = new byte[size];
+        final Rnd rnd = new Rnd();
+        for (int i = 0; i < size; i++) {
+            bytes[i] = rnd.nextByte();
+        }
+        try (FileOutputStream fos = new FileOutputStream(file)) {
+            fos.write(bytes);
+        }
+    }
 }
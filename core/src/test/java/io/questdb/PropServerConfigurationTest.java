@@ -82,6 +82,7 @@ public class PropServerConfigurationTest {
         Assert.assertFalse(configuration.getHttpServerConfiguration().haltOnError());
         Assert.assertFalse(configuration.getHttpServerConfiguration().haltOnError());
         Assert.assertEquals(2097152, configuration.getHttpServerConfiguration().getHttpContextConfiguration().getSendBufferSize());
+        Assert.assertEquals(2097152, configuration.getHttpServerConfiguration().getHttpContextConfiguration().getResponseHeaderBufferSize());
         Assert.assertEquals("index.html", configuration.getHttpServerConfiguration().getStaticContentProcessorConfiguration().getIndexFileName());
         Assert.assertTrue(configuration.getHttpServerConfiguration().isEnabled());
         Assert.assertFalse(configuration.getHttpServerConfiguration().getHttpContextConfiguration().getDumpNetworkTraffic());
@@ -102,6 +103,7 @@ public class PropServerConfigurationTest {
         Assert.assertEquals("Keep-Alive: timeout=5, max=10000" + Misc.EOL, configuration.getHttpServerConfiguration().getStaticContentProcessorConfiguration().getKeepAliveHeader());
 
         Assert.assertEquals(256, configuration.getHttpServerConfiguration().getDispatcherConfiguration().getLimit());
+        Assert.assertFalse(configuration.getHttpServerConfiguration().getDispatcherConfiguration().isIOURingEnabled());
         Assert.assertEquals(256, configuration.getHttpServerConfiguration().getDispatcherConfiguration().getEventCapacity());
         Assert.assertEquals(256, configuration.getHttpServerConfiguration().getDispatcherConfiguration().getIOQueueCapacity());
         Assert.assertEquals(300000, configuration.getHttpServerConfiguration().getDispatcherConfiguration().getTimeout());
@@ -202,6 +204,9 @@ public class PropServerConfigurationTest {
         Assert.assertEquals(2048, configuration.getLineUdpReceiverConfiguration().getMsgBufferSize());
         Assert.assertEquals(10000, configuration.getLineUdpReceiverConfiguration().getMsgCount());
         Assert.assertEquals(8388608, configuration.getLineUdpReceiverConfiguration().getReceiveBufferSize());
+        Assert.assertEquals(67108864, configuration.getLineUdpReceiverConfiguration().getReceiveBufferMaxSize());
+        Assert.assertFalse(configuration.getLineUdpReceiverConfiguration().isGroEnabled());
+        Assert.assertEquals(1, configuration.getLineUdpReceiverConfiguration().getShardCount());
         Assert.assertSame(AllowAllCairoSecurityContext.INSTANCE, configuration.getLineUdpReceiverConfiguration().getCairoSecurityContext());
         Assert.assertTrue(configuration.getLineUdpReceiverConfiguration().isEnabled());
         Assert.assertEquals(-1, configuration.getLineUdpReceiverConfiguration().ownThreadAffinity());
@@ -224,6 +229,18 @@ public class PropServerConfigurationTest {
         Assert.assertEquals(1024 * 1024, configuration.getCairoConfiguration().getSqlJitRowsThreshold());
         Assert.assertEquals(1024 * 1024, configuration.getCairoConfiguration().getSqlJitPageAddressCacheThreshold());
         Assert.assertFalse(configuration.getCairoConfiguration().isSqlJitDebugEnabled());
+        Assert.assertFalse(configuration.getCairoConfiguration().isReaderMadviseEnabled());
+        Assert.assertEquals(64, configuration.getCairoConfiguration().getPrefetchQueueCapacity());
+        Assert.assertEquals(0, configuration.getCairoConfiguration().getReaderPrefetchDistance());
+        Assert.assertFalse(configuration.getCairoConfiguration().isWriterDirectIoEnabled());
+        Assert.assertEquals(1024 * 1024, configuration.getCairoConfiguration().getWriterDirectIoBufferSize());
+        Assert.assertFalse(configuration.getCairoConfiguration().isWriterBatchSyncEnabled());
+        Assert.assertEquals(0, configuration.getCairoConfiguration().getWriterMmapReserveSize());
+        Assert.assertFalse(configuration.getCairoConfiguration().isPartitionChecksumEnabled());
+        Assert.assertEquals(64 * 1024 * 1024, configuration.getCairoConfiguration().getPartitionChecksumIoBudget());
+        Assert.assertEquals(64, configuration.getCairoConfiguration().getPartitionChecksumQueueCapacity());
+        Assert.assertEquals(0, configuration.getCairoConfiguration().getWriterFilePoolCapacity());
+        Assert.assertEquals(64, configuration.getCairoConfiguration().getWriterFilePoolQueueCapacity());
 
         Assert.assertEquals(8192, configuration.getCairoConfiguration().getRndFunctionMemoryPageSize());
         Assert.assertEquals(128, configuration.getCairoConfiguration().getRndFunctionMemoryMaxPages());
@@ -266,6 +283,8 @@ public class PropServerConfigurationTest {
         Assert.assertEquals(256, configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().getListenBacklog());
         Assert.assertEquals(-1, configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().getRcvBufSize());
         Assert.assertEquals(-1, configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().getSndBufSize());
+        Assert.assertEquals(0, configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().getBusyPollUsec());
+        Assert.assertFalse(configuration.getLineTcpReceiverConfiguration().isListenerPerWorkerEnabled());
         Assert.assertEquals(8, configuration.getLineTcpReceiverConfiguration().getConnectionPoolInitialCapacity());
         Assert.assertEquals(LineProtoNanoTimestampAdapter.INSTANCE, configuration.getLineTcpReceiverConfiguration().getTimestampAdapter());
         Assert.assertEquals(32768, configuration.getLineTcpReceiverConfiguration().getNetMsgBufferSize());
@@ -606,6 +625,7 @@ public class PropServerConfigurationTest {
             Assert.assertArrayEquals(new int[]{1, 2, 3, 4, 5, 6}, configuration.getHttpServerConfiguration().getWorkerAffinity());
             Assert.assertTrue(configuration.getHttpServerConfiguration().haltOnError());
             Assert.assertEquals(128, configuration.getHttpServerConfiguration().getHttpContextConfiguration().getSendBufferSize());
+            Assert.assertEquals(128, configuration.getHttpServerConfiguration().getHttpContextConfiguration().getResponseHeaderBufferSize());
             Assert.assertEquals("index2.html", configuration.getHttpServerConfiguration().getStaticContentProcessorConfiguration().getIndexFileName());
             Assert.assertFalse(configuration.getHttpServerConfiguration().isQueryCacheEnabled());
             Assert.assertEquals(32, configuration.getHttpServerConfiguration().getQueryCacheBlockCount());
@@ -735,6 +755,9 @@ public class PropServerConfigurationTest {
             Assert.assertEquals(4 * 1024 * 1024, configuration.getLineUdpReceiverConfiguration().getMsgBufferSize());
             Assert.assertEquals(4000, configuration.getLineUdpReceiverConfiguration().getMsgCount());
             Assert.assertEquals(512, configuration.getLineUdpReceiverConfiguration().getReceiveBufferSize());
+            Assert.assertEquals(4 * 1024 * 1024, configuration.getLineUdpReceiverConfiguration().getReceiveBufferMaxSize());
+            Assert.assertTrue(configuration.getLineUdpReceiverConfiguration().isGroEnabled());
+            Assert.assertEquals(4, configuration.getLineUdpReceiverConfiguration().getShardCount());
             Assert.assertEquals(PartitionBy.MONTH, configuration.getLineUdpReceiverConfiguration().getDefaultPartitionBy());
             Assert.assertFalse(configuration.getLineUdpReceiverConfiguration().isEnabled());
             Assert.assertEquals(2, configuration.getLineUdpReceiverConfiguration().ownThreadAffinity());
@@ -836,6 +859,7 @@ public class PropServerConfigurationTest {
             Assert.assertEquals(4194304, configuration.getHttpServerConfiguration().getDispatcherConfiguration().getSndBufSize());
             Assert.assertEquals(8388608, configuration.getHttpServerConfiguration().getDispatcherConfiguration().getRcvBufSize());
             Assert.assertTrue(configuration.getHttpServerConfiguration().getDispatcherConfiguration().getHint());
+            Assert.assertTrue(configuration.getHttpServerConfiguration().getDispatcherConfiguration().isIOURingEnabled());
 
             Assert.assertEquals(9120, configuration.getHttpMinServerConfiguration().getDispatcherConfiguration().getBindPort());
             Assert.assertEquals(8, configuration.getHttpMinServerConfiguration().getDispatcherConfiguration().getLimit());
@@ -851,6 +875,9 @@ public class PropServerConfigurationTest {
             Assert.assertEquals(1_002, configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().getQueueTimeout());
             Assert.assertEquals(32768, configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().getRcvBufSize());
             Assert.assertTrue(configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().getHint());
+            Assert.assertTrue(configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().isIOURingEnabled());
+            Assert.assertEquals(50, configuration.getLineTcpReceiverConfiguration().getDispatcherConfiguration().getBusyPollUsec());
+            Assert.assertTrue(configuration.getLineTcpReceiverConfiguration().isListenerPerWorkerEnabled());
 
             // Pg wire
             Assert.assertEquals(11, configuration.getPGWireConfiguration().getDispatcherConfiguration().getLimit());
@@ -859,6 +886,7 @@ public class PropServerConfigurationTest {
             Assert.assertEquals(32768, configuration.getPGWireConfiguration().getDispatcherConfiguration().getRcvBufSize());
             Assert.assertEquals(32800, configuration.getPGWireConfiguration().getDispatcherConfiguration().getSndBufSize());
             Assert.assertTrue(configuration.getPGWireConfiguration().getDispatcherConfiguration().getHint());
+            Assert.assertTrue(configuration.getPGWireConfiguration().getDispatcherConfiguration().isIOURingEnabled());
         }
     }
 
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.cairo;
+
+import io.questdb.MessageBusImpl;
+import io.questdb.std.Files;
+import io.questdb.std.FilesFacade;
+import io.questdb.std.FilesFacadeImpl;
+import io.questdb.std.datetime.microtime.Timestamps;
+import io.questdb.std.str.Path;
+import io.questdb.test.tools.TestUtils;
+import org.junit.Assert;
+import org.junit.Test;
+
+public class ColumnFilePoolTest extends AbstractCairoTest {
+    private static final long FILE_SIZE = 1024 * 1024;
+
+    @Test
+    public void testTakeAndTopUp() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final CairoConfiguration poolConfiguration = new PoolConfiguration(4);
+            final FilesFacade ff = FilesFacadeImpl.INSTANCE;
+            try (
+                    Path path = new Path().of(root).concat("pool");
+                    Path other = new Path();
+                    MessageBusImpl messageBus = new MessageBusImpl(poolConfiguration)
+            ) {
+                final int rootLen = path.length();
+                Assert.assertEquals(0, ff.mkdirs(path.slash$(), configuration.getMkDirMode()));
+                // left behind by writer that did not close
+                Assert.assertTrue(ff.touch(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(77).$()));
+                final ColumnFilePoolJob job = new ColumnFilePoolJob(messageBus);
+
+                try (ColumnFilePool pool = new ColumnFilePool(poolConfiguration, messageBus, path.trimTo(rootLen))) {
+                    Assert.assertFalse(ff.exists(path));
+
+                    // files are not there until job tops up the pool
+                    Assert.assertFalse(pool.take(other.of(path.trimTo(rootLen)).concat("a.d").$()));
+                    Assert.assertTrue(job.run(0));
+                    Assert.assertFalse(job.run(0));
+                    for (int i = 0; i < 4; i++) {
+                        Assert.assertEquals(FILE_SIZE, ff.length(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(i).$()));
+                    }
+
+                    Assert.assertTrue(pool.take(other.of(path.trimTo(rootLen)).concat("a.d").$()));
+                    Assert.assertEquals(FILE_SIZE, ff.length(other));
+                    Assert.assertFalse(ff.exists(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(0).$()));
+
+                    // second take leaves half of the pool, which triggers top up
+                    Assert.assertTrue(pool.take(other.of(path.trimTo(rootLen)).concat("b.d").$()));
+                    Assert.assertTrue(job.run(0));
+                    Assert.assertFalse(job.run(0));
+                    Assert.assertTrue(ff.exists(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(5).$()));
+                    Assert.assertFalse(ff.exists(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(6).$()));
+                }
+
+                // unused files are removed on close
+                for (int i = 2; i < 6; i++) {
+                    Assert.assertFalse(ff.exists(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(i).$()));
+                }
+            }
+        });
+    }
+
+    @Test
+    public void testWriterTakesFilesOfNewPartition() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final CairoConfiguration poolConfiguration = new PoolConfiguration(8);
+            try (TableModel model = new TableModel(poolConfiguration, "x", PartitionBy.DAY)
+                    .col("i", ColumnType.INT)
+                    .col("s", ColumnType.STRING)
+                    .timestamp()) {
+                CairoTestUtils.create(model);
+            }
+
+            try (
+                    Path path = new Path().of(root).concat("x");
+                    MessageBusImpl messageBus = new MessageBusImpl(poolConfiguration)
+            ) {
+                final int rootLen = path.length();
+                final ColumnFilePoolJob job = new ColumnFilePoolJob(messageBus);
+                try (TableWriter writer = new TableWriter(poolConfiguration, "x", messageBus, metrics)) {
+                    for (int day = 0; day < 3; day++) {
+                        while (job.run(0)) {
+                            // top up the pool
+                        }
+                        for (int i = 0; i < 10; i++) {
+                            TableWriter.Row row = writer.newRow(day * Timestamps.DAY_MICROS + i);
+                            row.putInt(0, i);
+                            row.putStr(1, "abc");
+                            row.append();
+                        }
+                        writer.commit();
+                    }
+                    // each partition takes data files of the three columns and index file of string column
+                    Assert.assertFalse(Files.exists(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(11).$()));
+                    Assert.assertTrue(Files.exists(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(12).$()));
+                }
+                for (int i = 0; i < 16; i++) {
+                    Assert.assertFalse(Files.exists(path.trimTo(rootLen).concat(ColumnFilePool.FILE_NAME_PREFIX).put(i).$()));
+                }
+
+                try (TableReader reader = new TableReader(poolConfiguration, "x")) {
+                    Assert.assertEquals(30, reader.size());
+                    Assert.assertEquals(3, reader.getPartitionCount());
+                }
+            }
+        });
+    }
+
+    private static class PoolConfiguration extends DefaultCairoConfiguration {
+        private final int capacity;
+
+        public PoolConfiguration(int capacity) {
+            super(root);
+            this.capacity = capacity;
+        }
+
+        @Override
+        public long getDataAppendPageSize() {
+            return FILE_SIZE;
+        }
+
+        @Override
+        public int getWriterFilePoolCapacity() {
+            return capacity;
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.cairo;
+
+import io.questdb.std.*;
+import io.questdb.std.str.Path;
+import io.questdb.test.tools.TestUtils;
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class DirectIoWriterTest extends AbstractCairoTest {
+
+    @Test
+    public void testSmallWriteBypassesDirectIo() throws Exception {
+        final AtomicInteger openCount = new AtomicInteger();
+        final FilesFacade ff = new FilesFacadeImpl() {
+            @Override
+            public long openDirect(long fd) {
+                openCount.incrementAndGet();
+                return super.openDirect(fd);
+            }
+        };
+        assertWrite(ff, 1024 * 1024, 13, 1024 * 1024 - 1);
+        Assert.assertEquals(0, openCount.get());
+    }
+
+    @Test
+    public void testUnsupportedFallsBackToPageCache() throws Exception {
+        final FilesFacade ff = new FilesFacadeImpl() {
+            @Override
+            public long openDirect(long fd) {
+                return -1;
+            }
+        };
+        Assert.assertFalse(assertWrite(ff, 64 * 1024, 4095, 3 * 64 * 1024 + 17));
+    }
+
+    @Test
+    public void testWriteAligned() throws Exception {
+        assertWrite(FilesFacadeImpl.INSTANCE, 64 * 1024, 0, 4 * 64 * 1024);
+    }
+
+    @Test
+    public void testWriteUnaligned() throws Exception {
+        // head and tail are not block aligned and have to be written via page cache
+        assertWrite(FilesFacadeImpl.INSTANCE, 64 * 1024, 4095, 3 * 64 * 1024 + 17);
+    }
+
+    private boolean assertWrite(FilesFacade ff, long bufferSize, long offset, long len) throws Exception {
+        final boolean[] supported = new boolean[1];
+        TestUtils.assertMemoryLeak(() -> {
+            final long fileSize = offset + len + 1024;
+            final long src = Unsafe.malloc(len, MemoryTag.NATIVE_DEFAULT);
+            final long dst = Unsafe.malloc(fileSize, MemoryTag.NATIVE_DEFAULT);
+            try (
+                    Path path = new Path().of(root).concat("direct.d").$();
+                    DirectIoWriter writer = new DirectIoWriter(bufferSize)
+            ) {
+                final Rnd rnd = new Rnd();
+                for (long i = 0; i < len; i++) {
+                    Unsafe.getUnsafe().putByte(src + i, rnd.nextByte());
+                }
+
+                long fd = ff.openRW(path, CairoConfiguration.O_NONE);
+                Assert.assertTrue(fd > -1);
+                try {
+                    Assert.assertTrue(ff.truncate(fd, fileSize));
+                    writer.write(ff, fd, src, len, offset);
+                    Assert.assertEquals(fileSize, ff.read(fd, dst, fileSize, 0));
+                } finally {
+                    ff.close(fd);
+                }
+
+                for (long i = 0; i < offset; i++) {
+                    Assert.assertEquals(0, Unsafe.getUnsafe().getByte(dst + i));
+                }
+                for (long i = 0; i < len; i++) {
+                    Assert.assertEquals(Unsafe.getUnsafe().getByte(src + i), Unsafe.getUnsafe().getByte(dst + offset + i));
+                }
+                for (long i = offset + len; i < fileSize; i++) {
+                    Assert.assertEquals(0, Unsafe.getUnsafe().getByte(dst + i));
+                }
+                supported[0] = writer.isSupported();
+            } finally {
+                Unsafe.free(src, len, MemoryTag.NATIVE_DEFAULT);
+                Unsafe.free(dst, fileSize, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+        return supported[0];
+    }
+}
@@ -49,6 +49,80 @@ public class FullFwdDataFrameCursorTest extends AbstractCairoTest {
     private static final int WORK_STEALING_CAS_FLAP = 4;
     private static final Log LOG = LogFactory.getLog(FullFwdDataFrameCursorTest.class);
 
+    @Test
+    public void testAdvisePartitions() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (TableModel model = new TableModel(configuration, "x", PartitionBy.DAY).
+                    col("a", ColumnType.INT).
+                    col("b", ColumnType.LONG).
+                    timestamp()
+            ) {
+                CairoTestUtils.create(model);
+            }
+
+            final int partitionCount = 3;
+            try (TableWriter writer = new TableWriter(configuration, "x", metrics)) {
+                for (int i = 0; i < partitionCount; i++) {
+                    TableWriter.Row row = writer.newRow(i * Timestamps.DAY_MICROS);
+                    row.putInt(0, i);
+                    row.putLong(1, i);
+                    row.append();
+                }
+                writer.commit();
+            }
+
+            final IntList advices = new IntList();
+            final FilesFacade ff = new FilesFacadeImpl() {
+                @Override
+                public int madvise(long address, long len, int advice) {
+                    advices.add(advice);
+                    return 0;
+                }
+            };
+
+            final CairoConfiguration adviseConfiguration = new DefaultCairoConfiguration(root) {
+                @Override
+                public FilesFacade getFilesFacade() {
+                    return ff;
+                }
+
+                @Override
+                public boolean isReaderMadviseEnabled() {
+                    return true;
+                }
+            };
+
+            try (TableReader reader = new TableReader(adviseConfiguration, "x", null)) {
+                FullFwdDataFrameCursor cursor = new FullFwdDataFrameCursor();
+                cursor.of(reader);
+                int frameCount = 0;
+                while (cursor.next() != null) {
+                    frameCount++;
+                }
+                Assert.assertEquals(partitionCount, frameCount);
+            }
+
+            // 3 columns per partition, every partition is advised sequential
+            // and all but the last are deactivated once scan moves on
+            int sequential = 0;
+            int cold = 0;
+            for (int i = 0, n = advices.size(); i < n; i++) {
+                switch (advices.getQuick(i)) {
+                    case Files.POSIX_MADV_SEQUENTIAL:
+                        sequential++;
+                        break;
+                    case Files.MADV_COLD:
+                        cold++;
+                        break;
+                    default:
+                        Assert.fail("unexpected advice: " + advices.getQuick(i));
+                }
+            }
+            Assert.assertEquals(3 * partitionCount, sequential);
+            Assert.assertEquals(3 * (partitionCount - 1), cold);
+        });
+    }
+
     @Test
     public void testClose() throws Exception {
         TestUtils.assertMemoryLeak(() -> {
@@ -487,6 +561,85 @@ public class FullFwdDataFrameCursorTest extends AbstractCairoTest {
         testParallelIndexFailureAtRuntime(PartitionBy.YEAR, 10000000L * 30 * 12, true, "1970" + Files.SEPARATOR + "c.v", 0);
     }
 
+    @Test
+    public void testPrefetchPartitions() throws Exception {
+        testPrefetchPartitions(64);
+    }
+
+    @Test
+    public void testPrefetchPartitionsQueueFull() throws Exception {
+        // nothing consumes the queue while cursor scans, columns that do not fit are advised inline
+        testPrefetchPartitions(2);
+    }
+
+    private void testPrefetchPartitions(int queueCapacity) throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (TableModel model = new TableModel(configuration, "x", PartitionBy.DAY).
+                    col("a", ColumnType.INT).
+                    col("b", ColumnType.LONG).
+                    timestamp()
+            ) {
+                CairoTestUtils.create(model);
+            }
+
+            final int partitionCount = 3;
+            try (TableWriter writer = new TableWriter(configuration, "x", metrics)) {
+                for (int i = 0; i < partitionCount; i++) {
+                    TableWriter.Row row = writer.newRow(i * Timestamps.DAY_MICROS);
+                    row.putInt(0, i);
+                    row.putLong(1, i);
+                    row.append();
+                }
+                writer.commit();
+            }
+
+            final IntList advices = new IntList();
+            final FilesFacade ff = new FilesFacadeImpl() {
+                @Override
+                public int madvise(long address, long len, int advice) {
+                    advices.add(advice);
+                    return 0;
+                }
+            };
+
+            final CairoConfiguration prefetchConfiguration = new DefaultCairoConfiguration(root) {
+                @Override
+                public FilesFacade getFilesFacade() {
+                    return ff;
+                }
+
+                @Override
+                public int getPrefetchQueueCapacity() {
+                    return queueCapacity;
+                }
+
+                @Override
+                public int getReaderPrefetchDistance() {
+                    return 1;
+                }
+            };
+
+            try (
+                    MessageBusImpl messageBus = new MessageBusImpl(prefetchConfiguration);
+                    TableReader reader = new TableReader(prefetchConfiguration, "x", messageBus)
+            ) {
+                final PrefetchJob job = new PrefetchJob(messageBus);
+
+                // every partition but the first one is prefetched while scan is on the preceding partition
+                final int expectedCount = 3 * (partitionCount - 1);
+                final int expectedQueued = Math.min(queueCapacity, expectedCount);
+                FullFwdDataFrameCursor fwdCursor = new FullFwdDataFrameCursor();
+                fwdCursor.of(reader);
+                assertPrefetched(fwdCursor, job, advices, expectedCount, expectedQueued);
+
+                advices.clear();
+                FullBwdDataFrameCursor bwdCursor = new FullBwdDataFrameCursor();
+                bwdCursor.of(reader);
+                assertPrefetched(bwdCursor, job, advices, expectedCount, expectedQueued);
+            }
+        });
+    }
+
     @Test
     public void testRemoveFirstColByDay() throws Exception {
         testRemoveFirstColumn(PartitionBy.DAY, 1000000 * 60 * 5, 3);
@@ -2415,6 +2568,25 @@ public class FullFwdDataFrameCursorTest extends AbstractCairoTest {
         });
     }
 
+    private static void assertPrefetched(DataFrameCursor cursor, PrefetchJob job, IntList advices, int expectedCount, int expectedQueued) {
+        int frameCount = 0;
+        while (cursor.next() != null) {
+            frameCount++;
+        }
+        Assert.assertEquals(3, frameCount);
+        Assert.assertEquals(expectedCount - expectedQueued, advices.size());
+
+        int taskCount = 0;
+        while (job.run(0)) {
+            taskCount++;
+        }
+        Assert.assertEquals(expectedQueued, taskCount);
+        Assert.assertEquals(expectedCount, advices.size());
+        for (int i = 0, n = advices.size(); i < n; i++) {
+            Assert.assertEquals(Files.POSIX_MADV_WILLNEED, advices.getQuick(i));
+        }
+    }
+
     private static class SymbolGroup {
 
         final String[] symA;
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.cairo;
+
+import io.questdb.std.*;
+import io.questdb.std.datetime.microtime.MicrosecondClock;
+import io.questdb.std.str.Path;
+import io.questdb.tasks.PartitionChecksumTask;
+import io.questdb.test.tools.TestUtils;
+import org.junit.Assert;
+import org.junit.Test;
+
+public class PartitionChecksumTest extends AbstractCairoTest {
+
+    @Test
+    public void testCorruptedFile() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (
+                    Path path = new Path().of(root).concat("2022-01-01").$();
+                    PartitionChecksum checksum = new PartitionChecksum(configuration)
+            ) {
+                createPartition(path);
+                Assert.assertEquals(2, checksum.write(path));
+                Assert.assertEquals(0, checksum.verify(path));
+
+                writeFile(path, "a.d", 1024, 42);
+                Assert.assertEquals(1, checksum.verify(path));
+            }
+        });
+    }
+
+    @Test
+    public void testIsChecksummed() {
+        Assert.assertTrue(PartitionChecksum.isChecksummed("a.d"));
+        Assert.assertTrue(PartitionChecksum.isChecksummed("a.i"));
+        Assert.assertTrue(PartitionChecksum.isChecksummed("a.d.12"));
+        Assert.assertTrue(PartitionChecksum.isChecksummed("a.i.3"));
+        Assert.assertFalse(PartitionChecksum.isChecksummed("a.k"));
+        Assert.assertFalse(PartitionChecksum.isChecksummed("a.v.12"));
+        Assert.assertFalse(PartitionChecksum.isChecksummed("a.d."));
+        Assert.assertFalse(PartitionChecksum.isChecksummed("a.12"));
+        Assert.assertFalse(PartitionChecksum.isChecksummed("_cksum"));
+    }
+
+    @Test
+    public void testMissingAndTruncatedFiles() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (
+                    Path path = new Path().of(root).concat("2022-01-01").$();
+                    PartitionChecksum checksum = new PartitionChecksum(configuration)
+            ) {
+                createPartition(path);
+                Assert.assertEquals(2, checksum.write(path));
+
+                final int len = path.length();
+                Assert.assertTrue(FilesFacadeImpl.INSTANCE.remove(path.concat("a.d").$()));
+                path.trimTo(len);
+                writeFile(path, "a.i", 100, 1);
+                Assert.assertEquals(2, checksum.verify(path));
+            }
+        });
+    }
+
+    @Test
+    public void testNoChecksums() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (
+                    Path path = new Path().of(root).concat("2022-01-01").$();
+                    PartitionChecksum checksum = new PartitionChecksum(configuration)
+            ) {
+                createPartition(path);
+                Assert.assertEquals(-1, checksum.verify(path));
+            }
+        });
+    }
+
+    @Test
+    public void testThrottled() throws Exception {
+        final long[] nowUs = {0};
+        final CairoConfiguration configuration = new DefaultCairoConfiguration(root) {
+            @Override
+            public MicrosecondClock getMicrosecondClock() {
+                return () -> nowUs[0];
+            }
+
+            @Override
+            public long getPartitionChecksumIoBudget() {
+                return 1024 * 1024;
+            }
+        };
+        TestUtils.assertMemoryLeak(() -> {
+            try (
+                    Path path = new Path().of(root).concat("2022-01-01").$();
+                    PartitionChecksum checksum = new PartitionChecksum(configuration)
+            ) {
+                createPartition(path);
+                checksum.of(path, PartitionChecksumTask.MODE_WRITE);
+
+                // clock stands still, budget is spent by the first file and the second one has to wait
+                int status;
+                while ((status = checksum.resume(true)) == PartitionChecksum.IN_PROGRESS) {
+                    // keep reading
+                }
+                Assert.assertEquals(PartitionChecksum.THROTTLED, status);
+                Assert.assertEquals(PartitionChecksum.THROTTLED, checksum.resume(true));
+                Assert.assertFalse(checksum.isIdle());
+
+                nowUs[0] += 10_000_000;
+                while ((status = checksum.resume(true)) == PartitionChecksum.IN_PROGRESS) {
+                    // keep reading
+                }
+                Assert.assertEquals(PartitionChecksum.DONE, status);
+                Assert.assertTrue(checksum.isIdle());
+                Assert.assertEquals(0, checksum.verify(path));
+            }
+        });
+    }
+
+    @Test
+    public void testVerifyAfterAppend() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (
+                    Path path = new Path().of(root).concat("2022-01-01").$();
+                    PartitionChecksum checksum = new PartitionChecksum(configuration)
+            ) {
+                createPartition(path);
+                Assert.assertEquals(2, checksum.write(path));
+
+                // data appended after checksum was taken is not covered by it
+                writeFile(path, "a.d", 4096, 1);
+                Assert.assertEquals(0, checksum.verify(path));
+            }
+        });
+    }
+
+    @Test
+    public void testVersionedColumnFile() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (
+                    Path path = new Path().of(root).concat("2022-01-01").$();
+                    PartitionChecksum checksum = new PartitionChecksum(configuration)
+            ) {
+                createPartition(path);
+                // column rewritten at column name txn 5
+                writeFile(path, "b.d.5", 2048, 3);
+                Assert.assertEquals(3, checksum.write(path));
+                Assert.assertEquals(0, checksum.verify(path));
+
+                writeFile(path, "b.d.5", 2048, 4);
+                Assert.assertEquals(1, checksum.verify(path));
+            }
+        });
+    }
+
+    private static void createPartition(Path path) {
+        final int pathLen = path.length();
+        Assert.assertEquals(0, FilesFacadeImpl.INSTANCE.mkdirs(path.slash$(), configuration.getMkDirMode()));
+        path.trimTo(pathLen);
+        writeFile(path, "a.d", 1024, 1);
+        writeFile(path, "a.i", 3 * 1024 * 1024 + 7, 1);
+        // not a column data file
+        writeFile(path, "a.k", 512, 1);
+    }
+
+    private static void writeFile(Path path, CharSequence name, long len, long seed) {
+        final FilesFacade ff = FilesFacadeImpl.INSTANCE;
+        final int pathLen = path.length();
+        final long buf = Unsafe.malloc(len, MemoryTag.NATIVE_DEFAULT);
+        try {
+            final Rnd rnd = new Rnd(seed, seed);
+            for (long i = 0; i < len; i++) {
+                Unsafe.getUnsafe().putByte(buf + i, rnd.nextByte());
+            }
+            final long fd = ff.openRW(path.concat(name).$(), CairoConfiguration.O_NONE);
+            Assert.assertTrue(fd > -1);
+            try {
+                Assert.assertEquals(len, ff.write(fd, buf, len, 0));
+            } finally {
+                ff.close(fd);
+            }
+        } finally {
+            Unsafe.free(buf, len, MemoryTag.NATIVE_DEFAULT);
+            path.trimTo(pathLen);
+        }
+    }
+}
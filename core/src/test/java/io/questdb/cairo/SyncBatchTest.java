@@ -0,0 +1,218 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.cairo;
+
+import io.questdb.std.*;
+import io.questdb.std.str.Path;
+import io.questdb.test.tools.TestUtils;
+import org.junit.*;
+import org.junit.rules.TemporaryFolder;
+
+public class SyncBatchTest {
+
+    @Rule
+    public final TemporaryFolder temp = new TemporaryFolder();
+
+    @Before
+    public void setUp() {
+        Assume.assumeTrue(IOURing.isAvailable());
+    }
+
+    @Test
+    public void testCoalesce() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (SyncBatch batch = new SyncBatch(FilesFacadeImpl.INSTANCE, 4)) {
+                batch.add(2, 100, 50);
+                batch.add(1, 0, 100);
+                batch.add(2, 0, 100);
+                batch.add(1, 200, 10);
+                batch.add(1, 100, 50);
+                batch.add(3, 0, 0);
+                // fd 1: [0, 150) and [200, 210), fd 2: [0, 150)
+                Assert.assertEquals(3, batch.coalesce());
+            }
+        });
+    }
+
+    @Test
+    public void testRingFailureFallsBackToFsync() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final int fileCount = 3;
+            final long size = Files.PAGE_SIZE;
+            final long buf = Unsafe.malloc(size, MemoryTag.NATIVE_DEFAULT);
+            final long[] fds = new long[fileCount];
+            final int[] fsyncCount = {0};
+            final FilesFacade ff = new FilesFacadeImpl() {
+                @Override
+                public int fsync(long fd) {
+                    fsyncCount[0]++;
+                    return super.fsync(fd);
+                }
+            };
+            // submission keeps failing, e.g. with EBUSY
+            final IOURing ring = new IOURing(4) {
+                @Override
+                public int submitAndWait(int waitNr) {
+                    return -16;
+                }
+            };
+            final int[] ringCount = {0};
+            try (Path path = new Path(); SyncBatch batch = new SyncBatch(ff, capacity -> ringCount[0]++ == 0 ? ring : new IOURing(capacity), 4)) {
+                Vect.memset(buf, size, 1);
+                for (int i = 0; i < fileCount; i++) {
+                    fds[i] = Files.openRW(path.of(temp.getRoot().getAbsolutePath()).concat("f" + i).$());
+                    Assert.assertTrue(fds[i] > -1);
+                    Assert.assertEquals(size, Files.write(fds[i], buf, size, 0));
+                    batch.add(fds[i], 0, size / 2);
+                    batch.add(fds[i], size / 2, size / 2);
+                }
+                // files are flushed once each
+                Assert.assertTrue(batch.sync());
+                Assert.assertEquals(fileCount, fsyncCount[0]);
+
+                // failed ring is replaced, next batch does not see its leftovers
+                for (int i = 0; i < fileCount; i++) {
+                    batch.add(fds[i], 0, size);
+                }
+                Assert.assertTrue(batch.sync());
+                Assert.assertEquals(fileCount, fsyncCount[0]);
+            } finally {
+                for (int i = 0; i < fileCount; i++) {
+                    if (fds[i] > 0) {
+                        Files.close(fds[i]);
+                    }
+                }
+                Unsafe.free(buf, size, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+    }
+
+    @Test
+    public void testRingCreationFailure() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            // e.g. RLIMIT_MEMLOCK is too low
+            final SyncBatch.RingFactory failingFactory = capacity -> {
+                throw CairoException.instance(12).put("could not create io_uring [capacity=").put(capacity).put(']');
+            };
+            Assert.assertNull(SyncBatch.newInstance(FilesFacadeImpl.INSTANCE, failingFactory, 4));
+        });
+    }
+
+    @Test
+    public void testRingReCreationFailureFallsBackToFsync() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final int fileCount = 3;
+            final long size = Files.PAGE_SIZE;
+            final long buf = Unsafe.malloc(size, MemoryTag.NATIVE_DEFAULT);
+            final long[] fds = new long[fileCount];
+            final int[] fsyncCount = {0};
+            final FilesFacade ff = new FilesFacadeImpl() {
+                @Override
+                public int fsync(long fd) {
+                    fsyncCount[0]++;
+                    return super.fsync(fd);
+                }
+            };
+            final IOURing ring = new IOURing(4) {
+                @Override
+                public int submitAndWait(int waitNr) {
+                    return -16;
+                }
+            };
+            final int[] ringCount = {0};
+            final SyncBatch.RingFactory factory = capacity -> {
+                if (ringCount[0]++ == 0) {
+                    return ring;
+                }
+                throw CairoException.instance(12).put("could not create io_uring [capacity=").put(capacity).put(']');
+            };
+            try (Path path = new Path(); SyncBatch batch = SyncBatch.newInstance(ff, factory, 4)) {
+                Assert.assertNotNull(batch);
+                Vect.memset(buf, size, 1);
+                for (int i = 0; i < fileCount; i++) {
+                    fds[i] = Files.openRW(path.of(temp.getRoot().getAbsolutePath()).concat("f" + i).$());
+                    Assert.assertTrue(fds[i] > -1);
+                    Assert.assertEquals(size, Files.write(fds[i], buf, size, 0));
+                    batch.add(fds[i], 0, size);
+                }
+                Assert.assertTrue(batch.sync());
+                Assert.assertEquals(fileCount, fsyncCount[0]);
+
+                // ring is gone, batch keeps syncing files one by one
+                for (int i = 0; i < fileCount; i++) {
+                    batch.add(fds[i], 0, size);
+                }
+                Assert.assertTrue(batch.sync());
+                Assert.assertEquals(2 * fileCount, fsyncCount[0]);
+                Assert.assertEquals(2, ringCount[0]);
+            } finally {
+                for (int i = 0; i < fileCount; i++) {
+                    if (fds[i] > 0) {
+                        Files.close(fds[i]);
+                    }
+                }
+                Unsafe.free(buf, size, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+    }
+
+    @Test
+    public void testSync() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final int fileCount = 10;
+            final long size = Files.PAGE_SIZE * 4;
+            final long buf = Unsafe.malloc(size, MemoryTag.NATIVE_DEFAULT);
+            final long[] fds = new long[fileCount];
+            // small ring makes batch span several submissions
+            try (Path path = new Path(); SyncBatch batch = new SyncBatch(FilesFacadeImpl.INSTANCE, 4)) {
+                Vect.memset(buf, size, 1);
+                for (int i = 0; i < fileCount; i++) {
+                    fds[i] = Files.openRW(path.of(temp.getRoot().getAbsolutePath()).concat("f" + i).$());
+                    Assert.assertTrue(fds[i] > -1);
+                    Assert.assertEquals(size, Files.write(fds[i], buf, size, 0));
+                    batch.add(fds[i], 0, size / 2);
+                    batch.add(fds[i], size / 2, size / 2);
+                }
+                Assert.assertTrue(batch.sync());
+
+                // batch is cleared by sync
+                Assert.assertEquals(0, batch.coalesce());
+
+                // bad descriptor fails the batch
+                batch.add(fds[0], 0, size);
+                batch.add(-1, 0, size);
+                Assert.assertFalse(batch.sync());
+            } finally {
+                for (int i = 0; i < fileCount; i++) {
+                    if (fds[i] > 0) {
+                        Files.close(fds[i]);
+                    }
+                }
+                Unsafe.free(buf, size, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+    }
+}
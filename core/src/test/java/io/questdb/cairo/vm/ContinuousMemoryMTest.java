@@ -36,8 +36,11 @@ import io.questdb.std.str.Path;
 import io.questdb.std.str.StringSink;
 import io.questdb.test.tools.TestUtils;
 import org.junit.Assert;
+import org.junit.Assume;
 import org.junit.Test;
 
+import java.util.concurrent.atomic.AtomicInteger;
+
 public class ContinuousMemoryMTest extends AbstractCairoTest {
 
     private static final Log LOG = LogFactory.getLog(ContinuousMemoryMTest.class);
@@ -606,6 +609,47 @@ public class ContinuousMemoryMTest extends AbstractCairoTest {
         });
     }
 
+    @Test
+    public void testReservedAddressRange() throws Exception {
+        Assume.assumeTrue(Os.type != Os.WINDOWS);
+        assertMemoryLeak(() -> {
+            final AtomicInteger remapCount = new AtomicInteger();
+            final FilesFacade ff = new FilesFacadeImpl() {
+                @Override
+                public long mremap(long fd, long addr, long previousSize, long newSize, long offset, int mode, int memoryTag) {
+                    remapCount.incrementAndGet();
+                    return super.mremap(fd, addr, previousSize, newSize, offset, mode, memoryTag);
+                }
+            };
+
+            final long reserveSize = 1024 * 1024;
+            final int N = (int) (reserveSize / Long.BYTES);
+            try (Path path = new Path().of(root).concat("reserved").$()) {
+                try (MemoryCMARWImpl mem = new MemoryCMARWImpl(ff, path, ff.getPageSize(), -1, reserveSize, MemoryTag.MMAP_DEFAULT, CairoConfiguration.O_NONE)) {
+                    final long address = mem.getPageAddress(0);
+                    for (int i = 0; i < N - 1; i++) {
+                        mem.putLong(i);
+                    }
+                    // file grew in place
+                    Assert.assertEquals(address, mem.getPageAddress(0));
+                    Assert.assertEquals(0, remapCount.get());
+
+                    // outgrow reservation, file is remapped as usual from now on
+                    for (int i = N - 1; i < 2 * N; i++) {
+                        mem.putLong(i);
+                    }
+                    for (int i = 0; i < 2 * N; i++) {
+                        Assert.assertEquals(i, mem.getLong(i * 8L));
+                    }
+
+                    mem.truncate();
+                    Assert.assertEquals(0, mem.getAppendOffset());
+                }
+                Assert.assertEquals(0, ff.length(path));
+            }
+        });
+    }
+
     @Test
     public void testShortAppend() throws Exception {
         withMem((rwMem, roMem) -> {
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.cutlass.http;
+
+import io.questdb.network.Net;
+import io.questdb.network.NetworkFacade;
+import io.questdb.network.NetworkFacadeImpl;
+import io.questdb.network.PeerDisconnectedException;
+import io.questdb.network.PeerIsSlowToReadException;
+import io.questdb.std.Misc;
+import io.questdb.std.Unsafe;
+import io.questdb.std.datetime.millitime.MillisecondClock;
+import io.questdb.std.str.StringSink;
+import io.questdb.test.tools.TestUtils;
+import org.junit.Assert;
+import org.junit.Test;
+
+public class HttpResponseSinkTest {
+
+    @Test
+    public void testLargeHeader() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final StringBuilder value = new StringBuilder();
+            for (int i = 0; i < 2_000; i++) {
+                value.append("large header ").append(i).append(';');
+            }
+            // well over 8KB that header buffer used to be capped at
+            Assert.assertTrue(value.length() > 32 * 1024);
+
+            final ThrottledFacade nf = new ThrottledFacade();
+            try (HttpResponseSink sink = new HttpResponseSink(configuration(nf))) {
+                sink.of(1);
+                final HttpChunkedResponseSocket socket = sink.getChunkedSocket();
+                socket.status(200, "text/plain");
+                socket.headers().put("X-Large: ").put(value).put(Misc.EOL);
+                socket.sendHeader();
+                socket.put("body");
+                socket.sendChunk(true);
+            }
+            TestUtils.assertContains(nf.out, "X-Large: " + value + Misc.EOL);
+            TestUtils.assertContains(nf.out, "body");
+        });
+    }
+
+    @Test
+    public void testPutISODate() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final long[] timestamps = {
+                    // epoch is the first value of the fresh sink
+                    0,
+                    -1,
+                    // leap day, and the day after it
+                    1582979696789012L,
+                    1583020800000000L,
+                    -2203894799999999L,
+                    1
+            };
+            final long[] dates = {
+                    1582979696789L,
+                    -1,
+                    0
+            };
+            final ThrottledFacade nf = new ThrottledFacade();
+            try (HttpResponseSink sink = new HttpResponseSink(configuration(nf))) {
+                sink.of(1);
+                final HttpChunkedResponseSocket socket = sink.getChunkedSocket();
+                socket.status(200, "text/plain");
+                socket.sendHeader();
+                for (long timestamp : timestamps) {
+                    socket.putISODate(timestamp).put('\n');
+                }
+                for (long date : dates) {
+                    socket.putISODateMillis(date).put('\n');
+                }
+                socket.sendChunk(true);
+            }
+            TestUtils.assertContains(
+                    nf.out,
+                    "1970-01-01T00:00:00.000000Z\n" +
+                            "1969-12-31T23:59:59.999999Z\n" +
+                            "2020-02-29T12:34:56.789012Z\n" +
+                            "2020-03-01T00:00:00.000000Z\n" +
+                            "1900-02-28T23:00:00.000001Z\n" +
+                            "1970-01-01T00:00:00.000001Z\n" +
+                            "2020-02-29T12:34:56.789Z\n" +
+                            "1969-12-31T23:59:59.999Z\n" +
+                            "1970-01-01T00:00:00.000Z\n"
+            );
+        });
+    }
+
+    @Test
+    public void testPartialSendv() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final StringBuilder message = new StringBuilder();
+            for (int i = 0; i < 50; i++) {
+                message.append("partial write ").append(i).append(';');
+            }
+
+            // whole response is sent in one go
+            final ThrottledFacade reference = new ThrottledFacade();
+            send(reference, message);
+            Assert.assertEquals(1, reference.sendvCalls);
+            final int headerLen = reference.firstHeaderLen;
+            Assert.assertTrue(headerLen > 0);
+            TestUtils.assertContains(reference.out, message);
+
+            final int[][] scenarios = {
+                    // header and part of the body, socket is full, then body in small pieces
+                    {headerLen + 5, 0, 3, 0, 7},
+                    // part of the header only, then remaining header and part of the body
+                    {10, 0, headerLen, 0, 1},
+                    // exactly the header, body is resumed later
+                    {headerLen, 0, 0, 100}
+            };
+            for (int[] budgets : scenarios) {
+                final ThrottledFacade nf = new ThrottledFacade(budgets);
+                send(nf, message);
+                TestUtils.assertEquals(reference.out, nf.out);
+                Assert.assertTrue(nf.sendvCalls > 0);
+            }
+        });
+    }
+
+    @Test
+    public void testSendFileTruncated() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final long[] results = {10, Net.ERETRY, Net.EEOF};
+            final ThrottledFacade nf = new ThrottledFacade() {
+                int call;
+
+                @Override
+                public long sendFile(long fd, long sockFd, long offset, long len) {
+                    return results[call++];
+                }
+            };
+            try (HttpResponseSink sink = new HttpResponseSink(configuration(nf))) {
+                sink.of(1);
+                final HttpRawSocket socket = sink.getRawSocket();
+                Assert.assertEquals(10, socket.sendFile(1, 0, 100));
+                try {
+                    socket.sendFile(1, 10, 90);
+                    Assert.fail();
+                } catch (PeerIsSlowToReadException ignore) {
+                    // socket is full
+                }
+                // file ends before promised length, resume loop must not spin
+                try {
+                    socket.sendFile(1, 10, 90);
+                    Assert.fail();
+                } catch (PeerDisconnectedException ignore) {
+                }
+            }
+        });
+    }
+
+    private static HttpContextConfiguration configuration(NetworkFacade nf) {
+        return new DefaultHttpContextConfiguration() {
+            @Override
+            public MillisecondClock getClock() {
+                return () -> 0;
+            }
+
+            @Override
+            public NetworkFacade getNetworkFacade() {
+                return nf;
+            }
+        };
+    }
+
+    private static void send(ThrottledFacade nf, CharSequence message) throws Exception {
+        try (HttpResponseSink sink = new HttpResponseSink(configuration(nf))) {
+            sink.of(1);
+            try {
+                sink.getSimple().sendStatus(400, message);
+            } catch (PeerIsSlowToReadException e) {
+                while (true) {
+                    try {
+                        sink.resumeSend();
+                        break;
+                    } catch (PeerIsSlowToReadException ignore) {
+                        // socket is still full
+                    }
+                }
+            }
+        }
+    }
+
+    // sends as many bytes as the next budget allows, unlimited when budgets run out
+    private static class ThrottledFacade extends NetworkFacadeImpl {
+        private final StringSink out = new StringSink();
+        private final int[] budgets;
+        private int call;
+        private int sendvCalls;
+        private int firstHeaderLen = -1;
+
+        ThrottledFacade(int... budgets) {
+            this.budgets = budgets;
+        }
+
+        @Override
+        public int send(long fd, long buffer, int bufferLen) {
+            final int n = Math.min(nextBudget(), bufferLen);
+            copy(buffer, n);
+            return n;
+        }
+
+        @Override
+        public int sendv(long fd, long iov, int iovCnt) {
+            sendvCalls++;
+            if (firstHeaderLen == -1) {
+                firstHeaderLen = (int) Unsafe.getUnsafe().getLong(iov + Long.BYTES);
+            }
+            int budget = nextBudget();
+            int total = 0;
+            for (int i = 0; i < iovCnt && budget > 0; i++) {
+                final long address = Unsafe.getUnsafe().getLong(iov + 2L * i * Long.BYTES);
+                final int n = (int) Math.min(budget, Unsafe.getUnsafe().getLong(iov + (2L * i + 1) * Long.BYTES));
+                copy(address, n);
+                budget -= n;
+                total += n;
+            }
+            return total;
+        }
+
+        private void copy(long address, int n) {
+            for (int i = 0; i < n; i++) {
+                out.put((char) Unsafe.getUnsafe().getByte(address + i));
+            }
+        }
+
+        private int nextBudget() {
+            return call < budgets.length ? budgets[call++] : Integer.MAX_VALUE;
+        }
+    }
+}
@@ -3008,6 +3008,55 @@ public class IODispatcherTest {
         );
     }
 
+    @Test
+    public void testJsonQueryEscapedLongString() throws Exception {
+        testJsonQuery0(1, engine -> {
+            sendAndReceive(
+                    NetworkFacadeImpl.INSTANCE,
+                    "GET /query?query=create%20table%20x%20as%20%28select%20%27The%20quick%20brown%20fox%20jumps%20over%20the%20lazy%20dog%2C%20%22quoted%22%2C%20back%5Cslash%2C%20%2Fpath%2Fto%2Ffile%2C%20tab%09here%2C%20then%20another%20long%20run%20of%20plain%20text%20up%20to%20the%20end%27%20s%2C%20cast%281646370367123456%20as%20timestamp%29%20ts%2C%20cast%281646370367123%20as%20date%29%20d%29 HTTP/1.1\r\n" +
+                            "Host: localhost:9000\r\n" +
+                            "Connection: keep-alive\r\n" +
+                            "Accept: */*\r\n" +
+                            "\r\n",
+                    "HTTP/1.1 200 OK\r\n" +
+                            "Server: questDB/1.0\r\n" +
+                            "Date: Thu, 1 Jan 1970 00:00:00 GMT\r\n" +
+                            "Transfer-Encoding: chunked\r\n" +
+                            "Content-Type: application/json; charset=utf-8\r\n" +
+                            "Keep-Alive: timeout=5, max=10000\r\n" +
+                            "\r\n" +
+                            JSON_DDL_RESPONSE,
+                    1,
+                    0,
+                    false
+            );
+
+            // string is long enough to be copied in bulk, with escapes in between
+            sendAndReceive(
+                    NetworkFacadeImpl.INSTANCE,
+                    "GET /query?query=x&count=true HTTP/1.1\r\n" +
+                            "Host: localhost:9000\r\n" +
+                            "Connection: keep-alive\r\n" +
+                            "Accept: */*\r\n" +
+                            "\r\n",
+                    "HTTP/1.1 200 OK\r\n" +
+                            "Server: questDB/1.0\r\n" +
+                            "Date: Thu, 1 Jan 1970 00:00:00 GMT\r\n" +
+                            "Transfer-Encoding: chunked\r\n" +
+                            "Content-Type: application/json; charset=utf-8\r\n" +
+                            "Keep-Alive: timeout=5, max=10000\r\n" +
+                            "\r\n" +
+                            "015a\r\n" +
+                            "{\"query\":\"x\",\"columns\":[{\"name\":\"s\",\"type\":\"STRING\"},{\"name\":\"ts\",\"type\":\"TIMESTAMP\"},{\"name\":\"d\",\"type\":\"DATE\"}],\"dataset\":[[\"The quick brown fox jumps over the lazy dog, \\\"quoted\\\", back\\\\slash, \\/path\\/to\\/file, tab\\there, then another long run of plain text up to the end\",\"2022-03-04T05:06:07.123456Z\",\"2022-03-04T05:06:07.123Z\"]],\"count\":1}\r\n" +
+                            "00\r\n" +
+                            "\r\n",
+                    1,
+                    0,
+                    false
+            );
+        }, false);
+    }
+
     @Test
     public void testJsonQueryGeoHashColumnChars() throws Exception {
         testHttpQueryGeoHashColumnChars(
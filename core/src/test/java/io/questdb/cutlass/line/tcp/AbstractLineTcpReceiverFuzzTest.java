@@ -388,6 +388,10 @@ abstract class AbstractLineTcpReceiverFuzzTest extends AbstractLineTcpReceiverTe
 
     void runTest(PoolListener listener, long minIdleMsBeforeWriterRelease) throws Exception {
         runInContext(receiver -> {
+            if (listenerPerWorker) {
+                Assert.assertEquals(getWorkerPoolConfiguration().getWorkerCount(), receiver.getDispatcherCount());
+            }
+
             for (int i = 0; i < numOfTables; i++) {
                 final CharSequence tableName = getTableName(i);
                 tables.put(tableName, new TableData(tableName));
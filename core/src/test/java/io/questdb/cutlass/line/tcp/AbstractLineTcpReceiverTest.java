@@ -77,6 +77,7 @@ class AbstractLineTcpReceiverTest extends AbstractCairoTest {
     protected long commitIntervalDefault = 2000;
     protected boolean disconnectOnError = false;
     protected boolean symbolAsFieldSupported;
+    protected boolean listenerPerWorker;
     protected final LineTcpReceiverConfiguration lineConfiguration = new DefaultLineTcpReceiverConfiguration() {
         @Override
         public boolean getDisconnectOnError() {
@@ -138,6 +139,11 @@ class AbstractLineTcpReceiverTest extends AbstractCairoTest {
             return minIdleMsBeforeWriterRelease;
         }
 
+        @Override
+        public boolean isListenerPerWorkerEnabled() {
+            return listenerPerWorker;
+        }
+
         @Override
         public boolean isSymbolAsFieldSupported() {
             return symbolAsFieldSupported;
@@ -288,11 +288,14 @@ abstract class BaseLineTcpContextTest extends AbstractCairoTest {
     protected void setupContext(AuthDb authDb, Runnable onCommitNewEvent) {
         disconnected = false;
         recvBuffer = null;
+        // network IO jobs are not created, dispatcher is never used
+        final ObjList<IODispatcher<LineTcpConnectionContext>> dispatchers = new ObjList<>();
+        dispatchers.add(null);
         scheduler = new LineTcpMeasurementScheduler(
                 lineTcpConfiguration,
                 engine,
                 createWorkerPool(1, true),
-                null,
+                dispatchers,
                 workerPool = createWorkerPool(nWriterThreads, false)) {
 
             @Override
@@ -1402,6 +1402,28 @@ public class LineTcpConnectionContextTest extends BaseLineTcpContextTest {
         testFragmentation("weat".length(), "weather1");
     }
 
+    @Test
+    public void testLongEntitiesWithEscapes() throws Exception {
+        // entities span several structural bitmap words, split across reads
+        runInContext(() -> {
+            final String a = Chars.repeat("a", 70).toString();
+            final String c = Chars.repeat("c", 70).toString();
+            final String x = Chars.repeat("x", 80).toString();
+            final String msg = "tbl,t1=" + a + "\\ b" + c + " f1=1234567890123456789i,f2=-12.25,f3=\"" + x + "\",f4=123456789012i 1465839830100400200\n";
+            final int breakPos = msg.indexOf(c) + 10;
+            recvBuffer = msg.substring(0, breakPos);
+            handleContextIO();
+            Assert.assertFalse(disconnected);
+            recvBuffer = msg.substring(breakPos);
+            handleContextIO();
+            Assert.assertFalse(disconnected);
+            closeContext();
+            String expected = "t1\tf1\tf2\tf3\tf4\ttimestamp\n" +
+                    a + " b" + c + "\t1234567890123456789\t-12.25\t" + x + "\t123456789012\t2016-06-13T17:43:50.100400Z\n";
+            assertTable(expected, "tbl");
+        });
+    }
+
     @Test
     public void testMaxSizes() throws Exception {
         String table = "maxSize";
@@ -114,6 +114,18 @@ public class LineTcpParser2Test extends LineUdpLexerTest {
         );
     }
 
+    @Test
+    public void testNanosecondTimestamp() {
+        assertThat(
+                "measurement,tag=value field=1.5 1465839830100400200\n",
+                "measurement,tag=value field=1.5 1465839830100400200\n"
+        );
+        assertThat(
+                "measurement,tag=value field=1.5 9223372036854775807\n",
+                "measurement,tag=value field=1.5 9223372036854775807\n"
+        );
+    }
+
     @Test
     public void testNoFields() {
         // Single space char between last tag and timestamp
@@ -27,6 +27,7 @@ package io.questdb.cutlass.line.tcp;
 import io.questdb.log.Log;
 import io.questdb.log.LogFactory;
 import io.questdb.std.Os;
+import org.junit.Assume;
 import org.junit.Test;
 
 public class LineTcpReceiverFuzzTest extends AbstractLineTcpReceiverFuzzTest {
@@ -73,6 +74,15 @@ public class LineTcpReceiverFuzzTest extends AbstractLineTcpReceiverFuzzTest {
         runTest();
     }
 
+    @Test
+    public void testLoadListenerPerWorker() throws Exception {
+        // SO_REUSEPORT listeners are balanced by the kernel on Linux only
+        Assume.assumeTrue(Os.type == Os.LINUX_AMD64 || Os.type == Os.LINUX_ARM64);
+        listenerPerWorker = true;
+        initLoadParameters(100, 5, 8, 4, 20);
+        runTest();
+    }
+
     @Test
     public void testLoadNoTagsStringsAsSymbol() throws Exception {
         initLoadParameters(100, Os.type == Os.WINDOWS ? 3 : 5, 7, 12, 20);
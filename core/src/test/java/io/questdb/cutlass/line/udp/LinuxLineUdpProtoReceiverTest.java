@@ -28,6 +28,8 @@ import io.questdb.WorkerPoolAwareConfiguration;
 import io.questdb.cairo.*;
 import io.questdb.cairo.security.AllowAllCairoSecurityContext;
 import io.questdb.cutlass.line.LineUdpSender;
+import io.questdb.mp.WorkerPool;
+import io.questdb.mp.WorkerPoolConfiguration;
 import io.questdb.network.Net;
 import io.questdb.network.NetworkError;
 import io.questdb.network.NetworkFacade;
@@ -117,6 +119,122 @@ public class LinuxLineUdpProtoReceiverTest extends AbstractCairoTest {
         assertFrequentCommit(LINUX_FACTORY);
     }
 
+    @Test
+    public void testLinuxGroReceive() throws Exception {
+        if (Os.type != Os.LINUX_AMD64) {
+            return;
+        }
+        assertReceive(new DefaultLineUdpReceiverConfiguration() {
+            @Override
+            public int getMsgBufferSize() {
+                return 65536;
+            }
+
+            @Override
+            public int getMsgCount() {
+                return 4;
+            }
+
+            @Override
+            public boolean isGroEnabled() {
+                return true;
+            }
+        }, LINUX_FACTORY);
+    }
+
+    @Test
+    public void testLinuxGroSmallBuffer() throws Exception {
+        if (Os.type != Os.LINUX_AMD64) {
+            return;
+        }
+        // GRO is not enabled when message buffer cannot fit coalesced datagrams
+        assertReceive(new DefaultLineUdpReceiverConfiguration() {
+            @Override
+            public boolean isGroEnabled() {
+                return true;
+            }
+        }, LINUX_FACTORY);
+    }
+
+    @Test
+    public void testLinuxShardedReceive() throws Exception {
+        if (Os.type != Os.LINUX_AMD64) {
+            return;
+        }
+        TestUtils.assertMemoryLeak(() -> {
+            final int senderCount = 8;
+            final int rowsPerSender = 10;
+            final LineUdpReceiverConfiguration receiverCfg = new DefaultLineUdpReceiverConfiguration() {
+                @Override
+                public int getShardCount() {
+                    return 2;
+                }
+
+                @Override
+                public boolean isUnicast() {
+                    return true;
+                }
+
+                @Override
+                public boolean ownThread() {
+                    return false;
+                }
+            };
+            final WorkerPool workerPool = new WorkerPool(new WorkerPoolConfiguration() {
+                @Override
+                public int[] getWorkerAffinity() {
+                    return new int[]{-1, -1};
+                }
+
+                @Override
+                public int getWorkerCount() {
+                    return 2;
+                }
+
+                @Override
+                public boolean haltOnError() {
+                    return false;
+                }
+            }, metrics);
+
+            try (CairoEngine engine = new CairoEngine(configuration)) {
+                try (TableModel model = new TableModel(configuration, "tab", PartitionBy.NONE)
+                        .col("sender", ColumnType.LONG)
+                        .col("size", ColumnType.DOUBLE)
+                        .timestamp()) {
+                    CairoTestUtils.create(model);
+                }
+
+                try (AbstractLineProtoUdpReceiver receiver = LINUX_FACTORY.create(receiverCfg, engine, workerPool, false, null, null, metrics)) {
+                    workerPool.start(LOG);
+                    try {
+                        // SO_REUSEPORT spreads flows across sockets by source port, each sender is a flow of its own
+                        for (int i = 0; i < senderCount; i++) {
+                            try (LineUdpSender sender = new LineUdpSender(NetworkFacadeImpl.INSTANCE, 0, Net.parseIPv4("127.0.0.1"), receiverCfg.getPort(), 1400, 1)) {
+                                for (int j = 0; j < rowsPerSender; j++) {
+                                    sender.metric("tab").field("sender", i).field("size", (double) j).$(100000000000L);
+                                }
+                                sender.flush();
+                            }
+                        }
+
+                        try (TableReader reader = new TableReader(new DefaultCairoConfiguration(root), "tab", null)) {
+                            int count = 1000000;
+                            while (count-- > 0 && reader.size() < senderCount * rowsPerSender) {
+                                reader.reload();
+                                Os.pause();
+                            }
+                            Assert.assertEquals(senderCount * rowsPerSender, reader.size());
+                        }
+                    } finally {
+                        // shard jobs run on the pool, it has to stop before receiver is closed
+                        workerPool.halt();
+                    }
+                }
+            }
+        });
+    }
+
     @Test
     public void testLinuxSimpleReceive() throws Exception {
         if (Os.type != Os.LINUX_AMD64) {
@@ -5161,6 +5161,65 @@ create table tab as (
         );
     }
 
+    @Test
+    public void testSelectFixedWidthTypesBinary() throws Exception {
+        // all columns are fixed width and sent in binary format, so that rows take the fixed width encoder path
+        assertMemoryLeak(() -> {
+            try (
+                    final PGWireServer ignored = createPGServer(1);
+                    final Connection connection = getConnection(false, true)
+            ) {
+                CallableStatement stmt = connection.prepareCall(
+                        "create table x as (select" +
+                                " cast(x as int) kk, " +
+                                " rnd_int() a," +
+                                " rnd_boolean() b," +
+                                " rnd_str(1,1,2) c," +
+                                " rnd_double(2) d," +
+                                " rnd_float(2) e," +
+                                " rnd_short(10,1024) f," +
+                                " rnd_date(to_date('2015', 'yyyy'), to_date('2016', 'yyyy'), 2) g," +
+                                " rnd_symbol(4,4,4,2) i," +
+                                " rnd_long() j," +
+                                " timestamp_sequence(889001, 8890012) k," +
+                                " rnd_byte(2,50) l" +
+                                " from long_sequence(15))"
+                );
+                stmt.execute();
+
+                try (PreparedStatement statement = connection.prepareStatement(
+                        "select kk, a, b, d, e, f, g, j, k, l, cast(null as int) ni, cast(null as long) nl from x"
+                )) {
+                    for (int i = 0; i < 10; i++) {
+                        sink.clear();
+                        try (ResultSet rs = statement.executeQuery()) {
+                            assertResultSet(
+                                    "kk[INTEGER],a[INTEGER],b[BIT],d[DOUBLE],e[REAL],f[SMALLINT],g[TIMESTAMP],j[BIGINT],k[TIMESTAMP],l[SMALLINT],ni[INTEGER],nl[BIGINT]\n" +
+                                            "1,1569490116,false,null,0.761,428,2015-05-16 20:27:48.158,-8671107786057422727,1970-01-01 00:00:00.889001,26,null,null\n" +
+                                            "2,-461611463,false,0.9687423276940171,0.676,279,2015-11-21 14:32:13.134,-6794405451419334859,1970-01-01 00:00:09.779013,6,null,null\n" +
+                                            "3,-1515787781,false,0.8001121139739173,0.188,759,2015-06-17 02:40:55.328,-4091897709796604687,1970-01-01 00:00:18.669025,6,null,null\n" +
+                                            "4,1235206821,true,0.9540069089049732,0.255,310,null,6623443272143014835,1970-01-01 00:00:27.559037,17,null,null\n" +
+                                            "5,454820511,false,0.9918093114862231,0.324,727,2015-02-10 08:56:03.707,5703149806881083206,1970-01-01 00:00:36.449049,36,null,null\n" +
+                                            "6,1728220848,false,0.24642266252221556,0.267,174,2015-02-20 01:11:53.748,2151565237758036093,1970-01-01 00:00:45.339061,31,null,null\n" +
+                                            "7,-120660220,false,0.07594017197103131,0.064,542,2015-01-16 16:01:53.328,5048272224871876586,1970-01-01 00:00:54.229073,23,null,null\n" +
+                                            "8,-1548274994,true,0.9292491654871197,null,523,2015-01-05 19:01:46.416,9044897286885345735,1970-01-01 00:01:03.119085,16,null,null\n" +
+                                            "9,1430716856,false,0.7707249647497968,null,162,2015-02-05 10:14:02.889,7046578844650327247,1970-01-01 00:01:12.009097,47,null,null\n" +
+                                            "10,-772867311,false,0.7653255982993546,null,681,2015-05-07 02:45:07.603,4794469881975683047,1970-01-01 00:01:20.899109,31,null,null\n" +
+                                            "11,494704403,true,0.4834201611292943,0.794,28,2015-06-16 21:00:55.459,6785355388782691241,1970-01-01 00:01:29.789121,39,null,null\n" +
+                                            "12,-173290754,true,0.7198854503668188,null,114,2015-06-15 20:39:39.538,9064962137287142402,1970-01-01 00:01:38.679133,20,null,null\n" +
+                                            "13,-2041781509,true,0.44638626240707313,0.035,605,null,415951511685691973,1970-01-01 00:01:47.569145,28,null,null\n" +
+                                            "14,813111021,true,0.1389067130304884,0.373,259,null,4422067104162111415,1970-01-01 00:01:56.459157,19,null,null\n" +
+                                            "15,980916820,false,0.8353079103853974,0.011,670,2015-10-06 01:12:57.175,7536661420632276058,1970-01-01 00:02:05.349169,37,null,null\n",
+                                    sink,
+                                    rs
+                            );
+                        }
+                    }
+                }
+            }
+        });
+    }
+
     @Test
     public void testSemicolonExtendedMode() throws Exception {
         testSemicolon(false);
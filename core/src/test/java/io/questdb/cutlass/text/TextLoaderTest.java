@@ -1498,6 +1498,36 @@ public class TextLoaderTest extends AbstractGriffinTest {
         });
     }
 
+    @Test
+    public void testLongFieldsAndNumbers() throws Exception {
+        // fields longer than 64 bytes are skipped over in bulk, numbers with more than
+        // 18 digits fall back from fast path to full parser
+        assertNoLeak(textLoader -> {
+            final String expected = "f0\tf1\tf2\tf3\n" +
+                    "1\taaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa, \"quoted\" bbbbbbbbbbbbbbbbbbbbbbbbbbbbbb\t-12.25\t1234567890123456789\n" +
+                    "2\t01234567890123456789012345678901234567890123456789012345678901234567890123456789\t0.125\t-9000000000\n" +
+                    "3\txyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz \n01234567890123456789012345678901234567890123456789012345678901234567890123456789\t3.141592653589793\t42\n" +
+                    "4\t01234567890123456789012345678901234567890123456789012345678901234567890123456789,01234567890123456789012345678901234567890123456789012345678901234567890123456789\t7.5\t0\n";
+
+            String csv = "1,\"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa, \"\"quoted\"\" bbbbbbbbbbbbbbbbbbbbbbbbbbbbbb\",-12.25,1234567890123456789\n" +
+                    "2,01234567890123456789012345678901234567890123456789012345678901234567890123456789,0.125,-9000000000\n" +
+                    "3,\"xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz xyz \n01234567890123456789012345678901234567890123456789012345678901234567890123456789\",3.141592653589793238,42\n" +
+                    "4,\"01234567890123456789012345678901234567890123456789012345678901234567890123456789,01234567890123456789012345678901234567890123456789012345678901234567890123456789\",7.5,0\n";
+
+            configureLoaderDefaults(textLoader, (byte) ',');
+            textLoader.setForceHeaders(false);
+            playText(
+                    textLoader,
+                    csv,
+                    150,
+                    expected,
+                    "{\"columnCount\":4,\"columns\":[{\"index\":0,\"name\":\"f0\",\"type\":\"INT\"},{\"index\":1,\"name\":\"f1\",\"type\":\"STRING\"},{\"index\":2,\"name\":\"f2\",\"type\":\"DOUBLE\"},{\"index\":3,\"name\":\"f3\",\"type\":\"LONG\"}],\"timestampIndex\":-1}",
+                    4,
+                    4
+            );
+        });
+    }
+
     @Test
     public void testMissingColumnHeader() throws Exception {
         assertNoLeak(textLoader -> {
@@ -0,0 +1,218 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+package io.questdb.network;
+
+import io.questdb.mp.SOCountDownLatch;
+import io.questdb.std.IOURing;
+import io.questdb.std.MemoryTag;
+import io.questdb.std.Unsafe;
+import io.questdb.test.tools.TestUtils;
+import org.junit.Assert;
+import org.junit.Assume;
+import org.junit.Before;
+import org.junit.Test;
+
+import java.util.concurrent.atomic.AtomicBoolean;
+
+public class IODispatcherIOURingTest {
+    private static final int BUF_SIZE = 1024;
+
+    @Before
+    public void setUp() {
+        Assume.assumeTrue(IOURing.isAvailable());
+    }
+
+    @Test
+    public void testEcho() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final SOCountDownLatch closeLatch = new SOCountDownLatch(1);
+            try (IODispatcher<EchoContext> dispatcher = IODispatchers.create(
+                    new DefaultIODispatcherConfiguration() {
+                        @Override
+                        public boolean isIOURingEnabled() {
+                            return true;
+                        }
+                    },
+                    (fd, d) -> new EchoContext(fd, closeLatch, d)
+            )) {
+                Assert.assertTrue(dispatcher instanceof IODispatcherIOURing);
+                final AtomicBoolean serverRunning = new AtomicBoolean(true);
+                final SOCountDownLatch serverHaltLatch = new SOCountDownLatch(1);
+                startServer(dispatcher, serverRunning, serverHaltLatch);
+
+                final long buf = Unsafe.malloc(BUF_SIZE, MemoryTag.NATIVE_DEFAULT);
+                long fd = Net.socketTcp(true);
+                final long sockAddr = Net.sockaddr("127.0.0.1", 9001);
+                try {
+                    TestUtils.assertConnect(fd, sockAddr);
+                    // every round trip re-arms poll of the connection
+                    for (int i = 0; i < 100; i++) {
+                        Unsafe.getUnsafe().putInt(buf, i);
+                        Assert.assertEquals(4, Net.send(fd, buf, 4));
+                        Unsafe.getUnsafe().putInt(buf, -1);
+                        Assert.assertEquals(4, Net.recv(fd, buf, 4));
+                        Assert.assertEquals(i, Unsafe.getUnsafe().getInt(buf));
+                    }
+                    Assert.assertEquals(0, Net.close(fd));
+                    fd = -1;
+                    closeLatch.await();
+                } finally {
+                    serverRunning.set(false);
+                    serverHaltLatch.await();
+                    if (fd != -1) {
+                        Net.close(fd);
+                    }
+                    Net.freeSockAddr(sockAddr);
+                    Unsafe.free(buf, BUF_SIZE, MemoryTag.NATIVE_DEFAULT);
+                }
+                Assert.assertEquals(0, dispatcher.getConnectionCount());
+            }
+        });
+    }
+
+    @Test
+    public void testFallbackToEpollWhenRingCannotBeCreated() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (IODispatcher<EchoContext> dispatcher = IODispatchers.create(
+                    new DefaultIODispatcherConfiguration() {
+                        @Override
+                        public int getEventCapacity() {
+                            // kernel refuses rings of more than 32768 entries with EINVAL
+                            return 65536;
+                        }
+
+                        @Override
+                        public boolean isIOURingEnabled() {
+                            return true;
+                        }
+                    },
+                    (fd, d) -> new EchoContext(fd, new SOCountDownLatch(1), d)
+            )) {
+                Assert.assertTrue(dispatcher instanceof IODispatcherLinux);
+            }
+        });
+    }
+
+    @Test
+    public void testIdleConnectionTimeout() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final SOCountDownLatch closeLatch = new SOCountDownLatch(1);
+            try (IODispatcher<EchoContext> dispatcher = IODispatchers.create(
+                    new DefaultIODispatcherConfiguration() {
+                        @Override
+                        public long getTimeout() {
+                            return 100;
+                        }
+
+                        @Override
+                        public boolean isIOURingEnabled() {
+                            return true;
+                        }
+                    },
+                    (fd, d) -> new EchoContext(fd, closeLatch, d)
+            )) {
+                final AtomicBoolean serverRunning = new AtomicBoolean(true);
+                final SOCountDownLatch serverHaltLatch = new SOCountDownLatch(1);
+                startServer(dispatcher, serverRunning, serverHaltLatch);
+
+                final long buf = Unsafe.malloc(BUF_SIZE, MemoryTag.NATIVE_DEFAULT);
+                final long fd = Net.socketTcp(true);
+                final long sockAddr = Net.sockaddr("127.0.0.1", 9001);
+                try {
+                    TestUtils.assertConnect(fd, sockAddr);
+                    closeLatch.await();
+                    // server has closed the connection
+                    Assert.assertTrue(Net.recv(fd, buf, BUF_SIZE) < 1);
+                } finally {
+                    serverRunning.set(false);
+                    serverHaltLatch.await();
+                    Net.close(fd);
+                    Net.freeSockAddr(sockAddr);
+                    Unsafe.free(buf, BUF_SIZE, MemoryTag.NATIVE_DEFAULT);
+                }
+                Assert.assertEquals(0, dispatcher.getConnectionCount());
+            }
+        });
+    }
+
+    private static void startServer(
+            IODispatcher<EchoContext> dispatcher,
+            AtomicBoolean serverRunning,
+            SOCountDownLatch serverHaltLatch
+    ) {
+        new Thread(() -> {
+            while (serverRunning.get()) {
+                dispatcher.run(0);
+                dispatcher.processIOQueue(
+                        (operation, context) -> {
+                            final int n = Net.recv(context.getFd(), context.buffer, BUF_SIZE);
+                            if (n > 0) {
+                                Assert.assertEquals(n, Net.send(context.getFd(), context.buffer, n));
+                                context.dispatcher.registerChannel(context, IOOperation.READ);
+                            } else {
+                                context.dispatcher.disconnect(context, IODispatcher.DISCONNECT_REASON_TEST);
+                            }
+                        }
+                );
+            }
+            serverHaltLatch.countDown();
+        }).start();
+    }
+
+    private static class EchoContext implements IOContext {
+        private final long fd;
+        private final long buffer = Unsafe.malloc(BUF_SIZE, MemoryTag.NATIVE_DEFAULT);
+        private final SOCountDownLatch closeLatch;
+        private final IODispatcher<EchoContext> dispatcher;
+
+        public EchoContext(long fd, SOCountDownLatch closeLatch, IODispatcher<EchoContext> dispatcher) {
+            this.fd = fd;
+            this.closeLatch = closeLatch;
+            this.dispatcher = dispatcher;
+        }
+
+        @Override
+        public void close() {
+            Unsafe.free(buffer, BUF_SIZE, MemoryTag.NATIVE_DEFAULT);
+            closeLatch.countDown();
+        }
+
+        @Override
+        public long getFd() {
+            return fd;
+        }
+
+        @Override
+        public IODispatcher<EchoContext> getDispatcher() {
+            return dispatcher;
+        }
+
+        @Override
+        public boolean invalid() {
+            return false;
+        }
+    }
+}
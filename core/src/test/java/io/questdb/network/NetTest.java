@@ -25,16 +25,24 @@
 package io.questdb.network;
 
 import io.questdb.std.Chars;
+import io.questdb.std.Files;
 import io.questdb.std.MemoryTag;
 import io.questdb.std.Os;
 import io.questdb.std.Unsafe;
 import io.questdb.std.str.CharSequenceZ;
+import io.questdb.std.str.Path;
 import io.questdb.std.str.StringSink;
 import io.questdb.test.tools.TestUtils;
 import org.junit.Assert;
+import org.junit.Assume;
 import org.junit.Ignore;
+import org.junit.Rule;
 import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
 
+import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
 import java.util.concurrent.BrokenBarrierException;
 import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.CyclicBarrier;
@@ -43,6 +51,8 @@ import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.concurrent.atomic.AtomicLong;
 
 public class NetTest {
+    @Rule
+    public final TemporaryFolder temp = new TemporaryFolder();
     private int port = 9992;
 
 
@@ -208,6 +218,104 @@ public class NetTest {
         Assert.assertFalse(threadFailed.get());
     }
 
+    @Test
+    public void testIncomingCpu() {
+        Assume.assumeTrue(Os.type == Os.LINUX_AMD64 || Os.type == Os.LINUX_ARM64);
+        long fd1 = Net.socketTcp(false);
+        long fd2 = Net.socketTcp(false);
+        try {
+            // two listeners of the same SO_REUSEPORT group pinned to different CPUs
+            Assert.assertEquals(0, Net.setReusePort(fd1));
+            Assert.assertEquals(0, Net.setIncomingCpu(fd1, 0));
+            Assert.assertTrue(Net.bindTcp(fd1, 0, 9996));
+            Assert.assertEquals(0, Net.setReusePort(fd2));
+            Assert.assertEquals(0, Net.setIncomingCpu(fd2, 1));
+            Assert.assertTrue(Net.bindTcp(fd2, 0, 9996));
+            Assert.assertEquals(0, Net.getIncomingCpu(fd1));
+            Assert.assertEquals(1, Net.getIncomingCpu(fd2));
+        } finally {
+            Net.close(fd1);
+            Net.close(fd2);
+        }
+    }
+
+    @Test
+    public void testSendFile() throws IOException {
+        int port = 9995;
+        String content = "0123456789abcdefghij";
+        File file = temp.newFile();
+        java.nio.file.Files.write(file.toPath(), content.getBytes(StandardCharsets.UTF_8));
+
+        long acceptFd = Net.socketTcp(true);
+        Assert.assertTrue(acceptFd > 0);
+        Assert.assertTrue(Net.bindTcp(acceptFd, 0, port));
+        Net.listen(acceptFd, 1024);
+
+        long clientFd = Net.socketTcp(true);
+        long sockAddr = Net.sockaddr("127.0.0.1", port);
+        TestUtils.assertConnect(clientFd, sockAddr);
+        try (Path path = new Path().of(file.getAbsolutePath()).$()) {
+            long fd = Files.openRO(path);
+            Assert.assertTrue(fd > -1);
+            Assert.assertEquals(10, Net.sendFile(fd, clientFd, 5, 10));
+            Files.close(fd);
+        }
+        Net.close(clientFd);
+        Net.freeSockAddr(sockAddr);
+
+        long serverFd = Net.accept(acceptFd);
+        StringSink sink = new StringSink();
+        long serverBuf = Unsafe.malloc(16, MemoryTag.NATIVE_DEFAULT);
+        Assert.assertEquals(10, Net.recv(serverFd, serverBuf, 16));
+        Chars.utf8Decode(serverBuf, serverBuf + 10, sink);
+        TestUtils.assertEquals(content.substring(5, 15), sink);
+        Unsafe.free(serverBuf, 16, MemoryTag.NATIVE_DEFAULT);
+        Net.close(serverFd);
+        Net.close(acceptFd);
+    }
+
+    @Test
+    public void testSendv() {
+        int port = 9994;
+        String header = "header,";
+        String body = "body";
+        StringSink sink = new StringSink();
+        CharSequenceZ headerZ = new CharSequenceZ(header);
+        CharSequenceZ bodyZ = new CharSequenceZ(body);
+        int msgLen = header.length() + body.length() + 1;
+
+        long acceptFd = Net.socketTcp(true);
+        Assert.assertTrue(acceptFd > 0);
+        Assert.assertTrue(Net.bindTcp(acceptFd, 0, port));
+        Net.listen(acceptFd, 1024);
+
+        long clientFd = Net.socketTcp(true);
+        long sockAddr = Net.sockaddr("127.0.0.1", port);
+        TestUtils.assertConnect(clientFd, sockAddr);
+        long iov = Unsafe.malloc(4 * Long.BYTES, MemoryTag.NATIVE_DEFAULT);
+        Unsafe.getUnsafe().putLong(iov, headerZ.address());
+        Unsafe.getUnsafe().putLong(iov + Long.BYTES, header.length());
+        // terminating zero of the body goes too
+        Unsafe.getUnsafe().putLong(iov + 2 * Long.BYTES, bodyZ.address());
+        Unsafe.getUnsafe().putLong(iov + 3 * Long.BYTES, body.length() + 1);
+        Assert.assertEquals(msgLen, Net.sendv(clientFd, iov, 2));
+        Unsafe.free(iov, 4 * Long.BYTES, MemoryTag.NATIVE_DEFAULT);
+        Net.close(clientFd);
+        Net.freeSockAddr(sockAddr);
+
+        long serverFd = Net.accept(acceptFd);
+        long serverBuf = Unsafe.malloc(msgLen, MemoryTag.NATIVE_DEFAULT);
+        Assert.assertEquals(msgLen, Net.recv(serverFd, serverBuf, msgLen));
+        Chars.utf8DecodeZ(serverBuf, sink);
+        TestUtils.assertEquals(header + body, sink);
+        Unsafe.free(serverBuf, msgLen, MemoryTag.NATIVE_DEFAULT);
+        Net.close(serverFd);
+
+        Net.close(acceptFd);
+        headerZ.close();
+        bodyZ.close();
+    }
+
     @Test
     public void testSeek() {
         int port = 9993;
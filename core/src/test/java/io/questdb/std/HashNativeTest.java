@@ -0,0 +1,177 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.std;
+
+import io.questdb.cairo.vm.Vm;
+import io.questdb.cairo.vm.api.MemoryCARW;
+import io.questdb.test.tools.TestUtils;
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.charset.StandardCharsets;
+
+public class HashNativeTest {
+
+    @Test
+    public void testCrc32c() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final int size = 1024;
+            final long mem = Unsafe.malloc(size, MemoryTag.NATIVE_DEFAULT);
+            try {
+                final byte[] check = "123456789".getBytes(StandardCharsets.US_ASCII);
+                for (int i = 0; i < check.length; i++) {
+                    Unsafe.getUnsafe().putByte(mem + i, check[i]);
+                }
+                Assert.assertEquals(0xe3069283, HashNative.crc32c(0, mem, check.length));
+
+                // RFC 3720 test vectors
+                Vect.memset(mem, 32, 0);
+                Assert.assertEquals(0x8a9136aa, HashNative.crc32c(0, mem, 32));
+                Vect.memset(mem, 32, 0xff);
+                Assert.assertEquals(0x62a8ab43, HashNative.crc32c(0, mem, 32));
+                for (int i = 0; i < 32; i++) {
+                    Unsafe.getUnsafe().putByte(mem + i, (byte) i);
+                }
+                Assert.assertEquals(0x46dd794e, HashNative.crc32c(0, mem, 32));
+
+                // running crc
+                final Rnd rnd = new Rnd();
+                for (int i = 0; i < size; i++) {
+                    Unsafe.getUnsafe().putByte(mem + i, rnd.nextByte());
+                }
+                for (int len = 0; len < size; len += 13) {
+                    final int half = len / 3;
+                    Assert.assertEquals(
+                            HashNative.crc32c(0, mem, len),
+                            HashNative.crc32c(HashNative.crc32c(0, mem, half), mem + half, len - half)
+                    );
+                }
+            } finally {
+                Unsafe.free(mem, size, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+    }
+
+    @Test
+    public void testHashLongColumn() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            // not a multiple of vector width
+            final int count = 1003;
+            final long size = (long) count * Long.BYTES;
+            final long src = Unsafe.malloc(size, MemoryTag.NATIVE_DEFAULT);
+            final long dst = Unsafe.malloc(size, MemoryTag.NATIVE_DEFAULT);
+            try {
+                final Rnd rnd = new Rnd();
+                for (int i = 0; i < count; i++) {
+                    Unsafe.getUnsafe().putLong(src + (long) i * Long.BYTES, rnd.nextLong());
+                }
+                HashNative.hashLongColumn(src, count, dst);
+                for (int i = 0; i < count; i++) {
+                    long k = Unsafe.getUnsafe().getLong(src + (long) i * Long.BYTES);
+                    k ^= k >>> 33;
+                    k *= 0xff51afd7ed558ccdL;
+                    k ^= k >>> 33;
+                    k *= 0xc4ceb9fe1a85ec53L;
+                    k ^= k >>> 33;
+                    Assert.assertEquals(k, Unsafe.getUnsafe().getLong(dst + (long) i * Long.BYTES));
+                }
+            } finally {
+                Unsafe.free(src, size, MemoryTag.NATIVE_DEFAULT);
+                Unsafe.free(dst, size, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+    }
+
+    @Test
+    public void testHashMem64() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final int size = 256;
+            final long mem = Unsafe.malloc(2 * size, MemoryTag.NATIVE_DEFAULT);
+            try {
+                final Rnd rnd = new Rnd();
+                for (int i = 0; i < size; i++) {
+                    final byte b = rnd.nextByte();
+                    Unsafe.getUnsafe().putByte(mem + i, b);
+                    Unsafe.getUnsafe().putByte(mem + size + i, b);
+                }
+                Assert.assertEquals(0, HashNative.hashMem64(mem, 0));
+                final LongHashSet hashes = new LongHashSet();
+                for (int len = 1; len <= size; len++) {
+                    final long hash = HashNative.hashMem64(mem, len);
+                    // depends on content only
+                    Assert.assertEquals(hash, HashNative.hashMem64(mem + size, len));
+                    Assert.assertTrue(hashes.excludes(hash));
+                    hashes.add(hash);
+                    // every byte matters
+                    final long p = mem + size + rnd.nextInt(len);
+                    final byte b = Unsafe.getUnsafe().getByte(p);
+                    Unsafe.getUnsafe().putByte(p, (byte) (b ^ 1));
+                    Assert.assertNotEquals(hash, HashNative.hashMem64(mem + size, len));
+                    Unsafe.getUnsafe().putByte(p, b);
+                }
+            } finally {
+                Unsafe.free(mem, 2 * size, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+    }
+
+    @Test
+    public void testHashStrColumn() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final String[] values = {"a", null, "", "GET /api/v1/orders", "Mozilla/5.0 (X11; Linux x86_64)", "a"};
+            final long hashesSize = (long) values.length * Long.BYTES;
+            final long hashes = Unsafe.malloc(hashesSize, MemoryTag.NATIVE_DEFAULT);
+            try (
+                    MemoryCARW data = Vm.getCARWInstance(1024, Integer.MAX_VALUE, MemoryTag.NATIVE_DEFAULT);
+                    MemoryCARW index = Vm.getCARWInstance(1024, Integer.MAX_VALUE, MemoryTag.NATIVE_DEFAULT)
+            ) {
+                for (String value : values) {
+                    index.putLong(data.getAppendOffset());
+                    if (value == null) {
+                        data.putNullStr();
+                    } else {
+                        data.putStr(value);
+                    }
+                }
+                HashNative.hashStrColumn(data.getAddress(), index.getAddress(), 1, values.length, hashes);
+                for (int i = 1; i < values.length; i++) {
+                    final long hash = Unsafe.getUnsafe().getLong(hashes + (i - 1) * 8L);
+                    if (values[i] == null || values[i].isEmpty()) {
+                        Assert.assertEquals(0, hash);
+                    } else {
+                        final long p = data.getAddress() + index.getLong(i * 8L);
+                        Assert.assertEquals(HashNative.hashMem64(p + 4, 2L * values[i].length()), hash);
+                    }
+                }
+                Assert.assertEquals(
+                        HashNative.hashMem64(data.getAddress() + index.getLong(0) + 4, 2),
+                        Unsafe.getUnsafe().getLong(hashes + (values.length - 2) * 8L)
+                );
+            } finally {
+                Unsafe.free(hashes, hashesSize, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+    }
+}
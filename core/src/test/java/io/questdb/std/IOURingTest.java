@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *     ___                  _   ____  ____
+ *    / _ \ _   _  ___  ___| |_|  _ \| __ )
+ *   | | | | | | |/ _ \/ __| __| | | |  _ \
+ *   | |_| | |_| |  __/\__ \ |_| |_| | |_) |
+ *    \__\_\\__,_|\___||___/\__|____/|____/
+ *
+ *  Copyright (c) 2014-2019 Appsicle
+ *  Copyright (c) 2019-2022 QuestDB
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+package io.questdb.std;
+
+import io.questdb.std.str.Path;
+import io.questdb.test.tools.TestUtils;
+import org.junit.Assert;
+import org.junit.Assume;
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+
+import java.io.File;
+
+public class IOURingTest {
+
+    @Rule
+    public final TemporaryFolder temp = new TemporaryFolder();
+
+    @Before
+    public void setUp() {
+        Assume.assumeTrue(IOURing.isAvailable());
+    }
+
+    @Test
+    public void testQueueFull() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            try (IOURing ring = new IOURing(3)) {
+                Assert.assertEquals(4, ring.getCapacity());
+                for (int i = 0; i < 4; i++) {
+                    Assert.assertEquals(i, ring.enqueueNop());
+                }
+                Assert.assertEquals(-1, ring.enqueueNop());
+
+                Assert.assertEquals(4, ring.submitAndWait(4));
+                int count = 0;
+                while (ring.nextCqe()) {
+                    Assert.assertEquals(0, ring.getCqeRes());
+                    count++;
+                }
+                Assert.assertEquals(4, count);
+                Assert.assertEquals(4, ring.enqueueNop());
+            }
+        });
+    }
+
+    @Test
+    public void testWriteSyncRead() throws Exception {
+        TestUtils.assertMemoryLeak(() -> {
+            final int pageSize = 4096;
+            final int pageCount = 8;
+            final long size = (long) pageSize * pageCount;
+            final long buf = Unsafe.malloc(size, MemoryTag.NATIVE_DEFAULT);
+            File file = temp.newFile();
+            try (
+                    Path path = new Path().of(file.getAbsolutePath()).$();
+                    IOURing ring = new IOURing(32)
+            ) {
+                long fd = Files.openRW(path);
+                Assert.assertTrue(fd > -1);
+                try {
+                    for (long i = 0; i < size; i++) {
+                        Unsafe.getUnsafe().putByte(buf + i, (byte) i);
+                    }
+
+                    Assert.assertTrue(ring.enqueueFallocate(fd, 0, size) > -1);
+                    for (int i = 0; i < pageCount; i++) {
+                        long offset = (long) i * pageSize;
+                        Assert.assertTrue(ring.enqueueWrite(fd, offset, buf + offset, pageSize, IOURing.FLAG_LINK) > -1);
+                    }
+                    long syncId = ring.enqueueFdatasync(fd);
+                    Assert.assertTrue(syncId > -1);
+                    Assert.assertEquals(pageCount + 2, ring.submitAndWait(pageCount + 2));
+
+                    int count = 0;
+                    while (ring.nextCqe()) {
+                        if (ring.getCqeId() == 0 || ring.getCqeId() == syncId) {
+                            Assert.assertEquals(0, ring.getCqeRes());
+                        } else {
+                            Assert.assertEquals(pageSize, ring.getCqeRes());
+                        }
+                        count++;
+                    }
+                    Assert.assertEquals(pageCount + 2, count);
+                    Assert.assertEquals(size, Files.length(fd));
+
+                    Vect.memset(buf, size, 0);
+                    long readId = ring.enqueueRead(fd, 0, buf, size);
+                    Assert.assertEquals(1, ring.submitAndWait(1));
+                    Assert.assertTrue(ring.nextCqe());
+                    Assert.assertEquals(readId, ring.getCqeId());
+                    Assert.assertEquals(size, ring.getCqeRes());
+                    for (long i = 0; i < size; i++) {
+                        Assert.assertEquals((byte) i, Unsafe.getUnsafe().getByte(buf + i));
+                    }
+                } finally {
+                    Files.close(fd);
+                }
+            } finally {
+                Unsafe.free(buf, size, MemoryTag.NATIVE_DEFAULT);
+            }
+        });
+    }
+}
@@ -487,6 +487,68 @@ public class NumbersTest {
         Numbers.parseInt000Greedy("1234", 0, 4);
     }
 
+    @Test
+    public void testParseDecimalDouble() throws Exception {
+        String[] handled = {"0", "-0", "-0.0", "1.", "-1.5", ".25", "12345678.5", "-1234567.123456789", "9007199254740992", "0.000001"};
+        for (String s : handled) {
+            Assert.assertEquals(s, Numbers.parseDouble(s), parseDecimalDouble(s), 0.0);
+        }
+        // negative zero is parsed as positive zero, same as parseDouble() does
+        Assert.assertEquals(Double.doubleToRawLongBits(Numbers.parseDouble("-0")), Double.doubleToRawLongBits(parseDecimalDouble("-0")));
+        Assert.assertEquals(Double.doubleToRawLongBits(Numbers.parseDouble("-0.0")), Double.doubleToRawLongBits(parseDecimalDouble("-0.0")));
+        Assert.assertEquals(Double.doubleToRawLongBits(0.0), Double.doubleToRawLongBits(parseDecimalDouble("-0.0")));
+
+        // more than 18 digits, or digits without the decimal point exceed 2^53
+        String[] notHandled = {"", "-", ".", "1.2.3", "1e5", "1.5E-3", "NaN", "-Infinity", "1234567890.1234567890", "12a",
+                "9007199254740993", "-123456789.123456789", "999999999999999999", "0.9007199254740993"};
+        for (String s : notHandled) {
+            Assert.assertTrue(s, Double.isNaN(parseDecimalDouble(s)));
+        }
+
+        for (int i = 0; i < 10_000; i++) {
+            // up to 15 digits
+            String s = Long.toString(rnd.nextLong() % 1_000_000_000_000L) + '.' + Math.abs(rnd.nextInt() % 1000);
+            Assert.assertEquals(s, Numbers.parseDouble(s), parseDecimalDouble(s), 0.0);
+        }
+
+        for (int i = 0; i < 10_000; i++) {
+            // 19 to 21 digits
+            String s = Long.toString(1_000_000_000_000_000L + Math.abs(rnd.nextLong() % 9_000_000_000_000_000L)) + '.' + (100 + Math.abs(rnd.nextInt() % 900));
+            Assert.assertTrue(s, Double.isNaN(parseDecimalDouble(s)));
+        }
+    }
+
+    @Test
+    public void testParseDecimalLong() throws Exception {
+        String[] handled = {"0", "-0", "7", "-12345678", "123456789", "999999999999999999", "-999999999999999999",
+                "1234567890123456789", "9223372036854775807", "-9223372036854775807", "0000000000000000001"};
+        for (String s : handled) {
+            Assert.assertEquals(s, Numbers.parseLong(s), parseDecimalLong(s));
+        }
+
+        // nanosecond ILP timestamp takes the fast path
+        Assert.assertEquals(1465839830100400200L, parseDecimalLong("1465839830100400200"));
+
+        String[] notHandled = {"", "-", "9223372036854775808", "9999999999999999999", "12345678901234567890",
+                "-9223372036854775808", "123456789012345678a", "12L", "1.5", "+1", "1234567a"};
+        for (String s : notHandled) {
+            Assert.assertEquals(s, Numbers.LONG_NaN, parseDecimalLong(s));
+        }
+
+        for (int i = 0; i < 10_000; i++) {
+            long value = rnd.nextLong() % 1_000_000_000_000_000_000L;
+            Assert.assertEquals(value, parseDecimalLong(Long.toString(value)));
+        }
+
+        for (int i = 0; i < 10_000; i++) {
+            // mostly 19 digits
+            long value = rnd.nextLong();
+            if (value != Long.MIN_VALUE) {
+                Assert.assertEquals(value, parseDecimalLong(Long.toString(value)));
+            }
+        }
+    }
+
     @Test
     public void testParseDoubleWithManyLeadingZeros() throws Exception {
         String s1 = "000000.000000000033458980809808359835083490580348503845";
@@ -900,4 +962,30 @@ public class NumbersTest {
         int x = Numbers.bswap(expected);
         Assert.assertEquals(expected, Numbers.bswap(x));
     }
+
+    private static double parseDecimalDouble(String s) {
+        final int len = s.length();
+        final long mem = Unsafe.malloc(len + 1, MemoryTag.NATIVE_DEFAULT);
+        try {
+            for (int i = 0; i < len; i++) {
+                Unsafe.getUnsafe().putByte(mem + i, (byte) s.charAt(i));
+            }
+            return Numbers.parseDecimalDouble(mem, mem + len);
+        } finally {
+            Unsafe.free(mem, len + 1, MemoryTag.NATIVE_DEFAULT);
+        }
+    }
+
+    private static long parseDecimalLong(String s) {
+        final int len = s.length();
+        final long mem = Unsafe.malloc(len + 1, MemoryTag.NATIVE_DEFAULT);
+        try {
+            for (int i = 0; i < len; i++) {
+                Unsafe.getUnsafe().putByte(mem + i, (byte) s.charAt(i));
+            }
+            return Numbers.parseDecimalLong(mem, mem + len);
+        } finally {
+            Unsafe.free(mem, len + 1, MemoryTag.NATIVE_DEFAULT);
+        }
+    }
 }
@@ -27,6 +27,7 @@ package io.questdb.std;
 import io.questdb.std.ex.FatalError;
 import io.questdb.std.str.Path;
 import io.questdb.test.tools.TestUtils;
+import org.junit.Assert;
 import org.junit.Rule;
 import org.junit.Test;
 import org.junit.rules.TemporaryFolder;
@@ -34,6 +35,7 @@ import org.junit.rules.TemporaryFolder;
 import java.io.File;
 import java.io.FileInputStream;
 import java.io.FileOutputStream;
+import java.util.zip.CRC32;
 import java.util.zip.GZIPInputStream;
 
 public class ZipTest {
@@ -41,6 +43,38 @@ public class ZipTest {
     @Rule
     public final TemporaryFolder temp = new TemporaryFolder();
 
+    @Test
+    public void testCrc32() {
+        // lengths go across both folded 64-byte blocks and the tail
+        final int size = 1024;
+        final byte[] bytes = new byte[size];
+        final Rnd rnd = new Rnd();
+        rnd.nextBytes(bytes);
+        long mem = Unsafe.malloc(size, MemoryTag.NATIVE_DEFAULT);
+        try {
+            for (int i = 0; i < size; i++) {
+                Unsafe.getUnsafe().putByte(mem + i, bytes[i]);
+            }
+            CRC32 expected = new CRC32();
+            for (int offset = 0; offset < 16; offset += 3) {
+                for (int len = 0; len < size - offset; len += 7) {
+                    expected.reset();
+                    expected.update(bytes, offset, len);
+                    Assert.assertEquals((int) expected.getValue(), Zip.crc32(0, mem + offset, len));
+
+                    // running crc
+                    final int half = len / 2;
+                    Assert.assertEquals(
+                            (int) expected.getValue(),
+                            Zip.crc32(Zip.crc32(0, mem + offset, half), mem + offset + half, len - half)
+                    );
+                }
+            }
+        } finally {
+            Unsafe.free(mem, size, MemoryTag.NATIVE_DEFAULT);
+        }
+    }
+
     @Test
     public void testGzip() throws Exception {
         try (Path path = new Path()) {